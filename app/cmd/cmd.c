@@ -2,16 +2,25 @@
 // Marcel Timm, RhinoDevel, 2019dec03
 
 #include "cmd.h"
+#include "cmd_chan.h"
+#include "cmd_dir.h"
+#include "cmd_index.h"
+#include "cmd_snap.h"
 #include "../config.h"
 #include "../mode/mode_type.h"
 #include "../tape/tape_input.h"
 #include "../../lib/assert.h"
 #include "../../lib/alloc/alloc.h"
 #include "../../lib/str/str.h"
+#include "../../lib/calc/calc.h"
+#include "../../lib/petasc/petasc.h"
 #include "../../lib/filesys/filesys.h"
+#include "../../lib/filecache/filecache.h"
 #include "../../lib/dir/dir.h"
-#include "../../lib/basic/basic.h"
+#include "../../lib/d64/d64.h"
+#include "../../lib/zip/zip.h"
 #include "../../lib/basic/basic_addr.h"
+#include "../../lib/mem/mem.h"
 #include "../../lib/ff14/source/ff.h"
 
 #ifndef NDEBUG
@@ -28,16 +37,46 @@
 
 #include <stdbool.h>
 
+#ifdef MT_LINUX
+    #include <string.h>
+#endif //MT_LINUX
+
 // - 16 characters available
-// - File system support (by choice) limited to 8.3 format.
-// => 16 - 8 - 1 - 3 = 4 characters available for commands.
+// - Long file names are used via their aliases of up to 16 characters (see
+//   dir.h), so names of 8.3 format (or shorter) are used as they are.
+// => 16 - 8 - 1 - 3 = 4 characters available for commands (with 8.3 names).
 //
 //                                 "   thegreat.prg "
 static char const * const s_mode = "mode ";
-static char const * const s_dir  = "$"; // (no parameters)
+static char const * const s_dir  = "$"; // Optionally followed by pattern
+                                        // and/or page, e.g.: "$*.PRG,2".
+static char const * const s_dir_sizes = "$#"; // Dense, with file sizes.
 static char const * const s_rm   = "rm ";
 static char const * const s_save = "+"; // Actually save file (no space).
-static char const * const s_cd   = "cd "; // Supports "..", too.
+static char const * const s_cd   = "cd "; // Supports "..", too, D64
+                                        // images and ZIP archives (see
+                                        // d64.h and zip.h).
+static char const * const s_multi = "&"; // Load all files listed in given
+                                         // file (fast mode, only).
+//
+// File index of all folders (see cmd_index.h):
+//
+static char const * const s_find = "?"; // Followed by pattern.
+static char const * const s_find_rebuild = "?!"; // Rebuild index.
+static char const * const s_load_found = "@"; // Followed by name (pattern).
+//
+// File channel for programs (fast mode, only):
+//
+static char const * const s_chan = "#"; // "#" alone <=> get next chunk.
+static char const * const s_chan_addr = "#="; // Followed by 4 hex. digits.
+static char const * const s_chan_write = "#>"; // Open file for writing.
+static char const * const s_chan_block = "#:"; // Followed by 4 hex. digits.
+static char const * const s_chan_append = "+#"; // Append payload to file.
+//
+// RAM snapshots (fast mode with wedge at top of memory, only):
+//
+static char const * const s_snap_save = ">"; // See snp_char in wedge.
+static char const * const s_snap_restore = "<"; // See rst_char in wedge.
 #ifndef NDEBUG
     static char const * const s_load_ymodem = "y*";
 #endif //NDEBUG
@@ -46,80 +85,357 @@ static char const * const s_cd   = "cd "; // Supports "..", too.
 // static char const * const s_mv   =    "mv "; // New file name by Pi.
 //
 // Anything else. => Load file.
+//
+// An existing file whose name starts like an added command (see
+// is_added_command()) is loaded instead, "#" alone and "+#" alone are always
+// commands.
 
 static bool (*s_save_mode)(char const * const) = 0;
 //
 // Initialized by cmd_reinit().
 
+static bool s_is_save_failed = false; // Queued save failed, see cmd_exec().
+
 static char * s_cur_dir_path = 0;
 //
 // Initialized by cmd_reinit(). Changed by exec_cd().
 
-static struct dir_entry * * create_dir_entry_arr(int * const entry_count)
+/** Get pattern and/or (one-based) page number from given listing arguments
+ *  (e.g. "2", "A*" or "*.PRG,2").
+ *
+ * - Caller takes ownership of pattern returned (0, if none given).
+ * - Page is set to 0, if none given.
+ * - Returns false, if page number is invalid.
+ */
+static bool get_dir_args(
+    char const * const args, char * * const pattern, uint32_t * const page)
+{
+    int const comma = str_get_last_index(args, ',');
+    char const * const page_str = comma == -1 ? args : args + comma + 1;
+
+    *pattern = 0;
+    *page = 0;
+
+    if(args[0] == '\0')
+    {
+        return true; // Nothing given.
+    }
+
+    if(page_str[0] != '\0')
+    {
+        *page = calc_str_to_dword(page_str);
+    }
+    if(comma == -1)
+    {
+        if(*page == UINT32_MAX)
+        {
+            *page = 0;
+            *pattern = str_create_copy(args); // Pattern, only.
+        }
+        return true;
+    }
+
+    if(*page == UINT32_MAX)
+    {
+        return false;
+    }
+    if(comma > 0)
+    {
+        *pattern = str_create_partial_copy(args, 0, (uint32_t)comma);
+    }
+    return true;
+}
+
+/** Return given character of a file name as it arrives from a Commodore
+ *  machine, in upper case (see dir_set_alias_char_func()).
+ */
+static char get_alias_char(char const c)
+{
+    char const ret_val = petasc_get_ascii(
+        petasc_get_petscii(c, MT_PETSCII_REPLACER), MT_ASCII_REPLACER);
+
+    return 'a' <= ret_val && ret_val <= 'z'
+        ? (char)(ret_val - ('a' - 'A'))
+        : ret_val;
+}
+
+/** Return given PETSCII character of a name in a D64 image as a character of
+ *  a file name arriving from a Commodore machine (see d64_mount()).
+ */
+static char get_d64_name_char(uint8_t const c)
+{
+    return petasc_get_ascii((char)c, MT_ASCII_REPLACER);
+}
+
+/** To be called by file system before a file gets written or the file system
+ *  gets unmounted [full path is 0, then, see filesys_set_on_change()].
+ */
+static void on_change(char const * const full_path)
+{
+    cmd_chan_on_change(full_path);
+    if(full_path == 0)
+    {
+        cmd_index_reset(); // (SD card may have changed)
+    }
+}
+
+/** Return true, if current folder is a D64 image or a ZIP archive.
+ */
+static bool is_in_image()
+{
+    return d64_is_mounted() || zip_is_mounted();
+}
+
+/** Return true, if given command starts like one of the commands that got
+ *  added after the original ones (mode, listing, remove, save and change
+ *  directory), whose prefixes may also start an existing file's name.
+ */
+static bool is_added_command(char const * const command)
+{
+    return str_starts_with(command, s_find)
+        || str_starts_with(command, s_load_found)
+        || str_starts_with(command, s_chan) // (also "#=", "#>" and "#:")
+        || str_starts_with(command, s_multi)
+        || str_starts_with(command, s_snap_save)
+        || str_starts_with(command, s_snap_restore);
+}
+
+/** Return true, if current folder (maybe a D64 image or a ZIP archive) holds
+ *  a file with exactly the given name.
+ */
+static bool is_file_in_cur_dir(char const * const name)
 {
-    struct dir_entry * * ret_val = 0;
+    if(is_in_image())
+    {
+        int count = 0;
+        struct dir_entry * * const arr = d64_is_mounted()
+            ? d64_create_entry_arr(0, &count)
+            : zip_create_entry_arr(0, &count);
+        bool ret_val = false;
 
-    *entry_count = -1;
+        if(arr == 0)
+        {
+            return false;
+        }
+        for(int i = 0;i < count && !ret_val;++i)
+        {
+            ret_val = !arr[i]->is_dir && str_are_equal(arr[i]->name, name);
+        }
+        dir_free_entry_arr(arr, count);
+        return ret_val;
+    }
 
-    filesys_remount();
+    filesys_mount();
     dir_reinit(s_cur_dir_path);
+    return dir_is_file(name);
+}
+
+/** Return true, if the wedge of given mode prints listings itself, instead
+ *  of loading them as BASIC PRG.
+ */
+static bool is_print_mode(enum mode_type const mode)
+{
+    switch(mode)
+    {
+        case mode_type_pet1tom: // (falls through)
+        case mode_type_pet2tom: // (falls through)
+        case mode_type_pet4tom: // (falls through)
+        case mode_type_vic20tom: // (falls through)
+        case mode_type_c64tof: // (falls through)
+        case mode_type_c64tom: // (falls through)
+        case mode_type_tedtom: // (falls through)
+        case mode_type_c128tof:
+        {
+            return true; // Wedge at top of memory.
+        }
 
-    ret_val = dir_create_entry_arr(entry_count);
+        default:
+        {
+            return false; // Tape buffer wedge or compatibility mode.
+        }
+    }
+}
 
-    dir_deinit();
-    filesys_unmount();
+static uint16_t get_basic_addr(enum mode_type const mode)
+{
+    // TODO: Don't do this in such a hard-coded way:
+    //
+    switch(mode)
+    {
+        case mode_type_c64tof: // (falls through)
+        case mode_type_c64tom:
+        {
+            return MT_BASIC_ADDR_C64;
+        }
+        case mode_type_vic20tom:
+        {
+            return MT_BASIC_ADDR_VIC;
+        }
+        case mode_type_tedtom:
+        {
+            return MT_BASIC_ADDR_TED;
+        }
+        case mode_type_c128tof:
+        {
+            return MT_BASIC_ADDR_C128;
+        }
 
-    return ret_val;
+        default:
+        {
+            return MT_BASIC_ADDR_PET;
+        }
+    }
 }
 
-static struct cmd_output * exec_dir(enum mode_type const mode)
+/** Return listing of files in mounted D64 image or ZIP archive with disk name
+ *  (or path of archive) as title, paged like a folder's listing.
+ */
+static struct cmd_output * create_image_dir_output(
+    enum mode_type const mode,
+    enum cmd_dir_layout const layout,
+    char const * const pattern,
+    uint32_t const page)
 {
-    struct cmd_output * ret_val = alloc_alloc(sizeof *ret_val);
-    int entry_count = -1;
-    struct dir_entry * * entry_arr = create_dir_entry_arr(&entry_count);
-    int name_count = 1 + entry_count;
-    char * * name_arr = alloc_alloc(name_count * sizeof *name_arr);
+    bool const is_d64 = d64_is_mounted();
+    int count = 0;
+    struct dir_entry * * const arr = is_d64
+        ? d64_create_entry_arr(pattern, &count)
+        : zip_create_entry_arr(pattern, &count);
 
-    name_arr[0] = str_create_concat(s_cur_dir_path, ":");
-    for(int i = 1;i < name_count;++i)
+    if(arr == 0)
     {
-        name_arr[i] = str_create_concat(
-            entry_arr[i - 1]->is_dir ? "DIR " : "    ",
-            entry_arr[i - 1]->name);
+        return 0;
     }
+    return cmd_dir_create_arr_output(
+        is_d64 ? d64_get_disk_name() : s_cur_dir_path,
+        arr,
+        count,
+        is_print_mode(mode),
+        get_basic_addr(mode),
+        layout,
+        page);
+}
 
-    dir_free_entry_arr(entry_arr, entry_count);
-    entry_arr = 0;
-    entry_count = -1;
+/**
+ * - Sizes are not supported, if the wedge prints the listing.
+ */
+static struct cmd_output * exec_dir(
+    enum mode_type const mode, char const * const command)
+{
+    bool const with_sizes = str_starts_with(command, s_dir_sizes);
+    char * pattern = 0;
+    uint32_t page = 0;
+    struct cmd_output * ret_val = 0;
 
-    ret_val->name = str_create_copy("DIRECTORY");
-    ret_val->bytes = basic_get_prints(
+    // Each byte costs much more time via tape encoding than via fast mode, so
+    // pack entries as dense as possible in compatibility mode:
+    //
+    enum cmd_dir_layout const layout = with_sizes
+        ? cmd_dir_layout_dense_sizes
+        : (mode == mode_type_save
+            ? cmd_dir_layout_dense
+            : cmd_dir_layout_lines);
+
+    if(!get_dir_args(
+            command + str_get_len(with_sizes ? s_dir_sizes : s_dir),
+            &pattern,
+            &page))
+    {
+        return 0;
+    }
 
-        // TODO: Don't do this in such a hard-coded way:
+    if(is_in_image())
+    {
+        ret_val = create_image_dir_output(mode, layout, pattern, page);
+    }
+    else if(is_print_mode(mode))
+    {
+        // Wedge at top of memory prints listing directly, without
+        // overwriting the program in memory:
         //
-        (mode == mode_type_c64tof || mode == mode_type_c64tom)
-            ? MT_BASIC_ADDR_C64
-            : (mode == mode_type_vic20tom
-                ? MT_BASIC_ADDR_VIC
-                : MT_BASIC_ADDR_PET),
+        ret_val = cmd_dir_create_print_output(s_cur_dir_path, pattern, page);
+    }
+    else
+    {
+        ret_val = cmd_dir_create_output(
+            s_cur_dir_path, get_basic_addr(mode), layout, pattern, page);
+    }
+
+    alloc_free(pattern);
+    return ret_val;
+}
+
+/** List files in all folders whose (normalized) names match the pattern given
+ *  via command.
+ */
+static struct cmd_output * exec_find(
+    enum mode_type const mode, char const * const command)
+{
+    char const * const pattern = command + str_get_len(s_find);
+    int count = 0, total = 0;
+
+    filesys_mount(); // (detects SD card change)
+    cmd_index_sync();
 
-        (char const * *)name_arr,
-        name_count,
-        MT_PETSCII_REPLACER,
-        &(ret_val->count));
+    struct dir_entry * * const arr = cmd_index_create_search_arr(
+        pattern, &count, &total);
+    char total_str[10 + 1];
+    int i = 0;
 
-    for(int i = 0;i < name_count;++i)
+    calc_dword_to_dec((uint32_t)total, total_str);
+    total_str[10] = '\0';
+    while(i < 9 && total_str[i] == '0')
     {
-        alloc_free(name_arr[i]);
-        name_arr[i] = 0;
+        ++i; // Skips leading zeros.
     }
-    alloc_free(name_arr);
-    name_arr = 0;
-    name_count = -1;
 
+    char * const header = str_create_concat_three(
+        pattern, ": ", total_str + i); // Count of all matches.
+    struct cmd_output * const ret_val = cmd_dir_create_list_output(
+        header, arr, count, is_print_mode(mode), get_basic_addr(mode));
+
+    alloc_free(header);
     return ret_val;
 }
 
+/** Load file found via index, without changing current folder.
+ */
+static struct cmd_output * exec_load_found(char const * const command)
+{
+    filesys_mount(); // (detects SD card change)
+    cmd_index_sync();
+
+    char * const path = cmd_index_create_path(
+        command + str_get_len(s_load_found));
+
+    if(path == 0)
+    {
+        return 0;
+    }
+
+    int const slash = str_get_last_index(path, '/');
+    char * const dir_path = slash == 0
+        ? str_create_copy("/")
+        : str_create_partial_copy(path, 0, (uint32_t)slash);
+    struct cmd_output * const o = alloc_alloc(sizeof *o);
+
+    o->bytes = filesys_load(dir_path, path + slash + 1, &(o->count));
+    if(o->bytes == 0)
+    {
+        alloc_free(o);
+        alloc_free(dir_path);
+        alloc_free(path);
+        return 0;
+    }
+    o->name = str_create_copy(path + slash + 1);
+    o->next = 0;
+    o->gen = 0;
+
+    alloc_free(dir_path);
+    alloc_free(path);
+    return o;
+}
+
 /**
  * - No support for deletion of empty subfolders.
  */
@@ -128,21 +444,32 @@ static bool exec_remove(char const * const command)
     FRESULT r = FR_NO_FILE;
     char const * const name_only = command + str_get_len(s_rm);
 
-    filesys_remount();
+    if(is_in_image())
+    {
+        return false; // (D64 images and ZIP archives are read-only)
+    }
+
+    filesys_mount();
     dir_reinit(s_cur_dir_path);
 
     if(dir_is_file(name_only))
     {
-        char * const full_path = dir_create_full_path(
+        char * const full_path = dir_create_full_path_of_alias(
             s_cur_dir_path, name_only);
 
+        cmd_chan_on_change(full_path); // (file may be open via channel)
         r = f_unlink(full_path);
+        filecache_remove(full_path);
+        if(r == FR_OK)
+        {
+            dir_index_remove(full_path);
+            cmd_index_remove(full_path);
+        }
 
         alloc_free(full_path);
     }
 
     dir_deinit();
-    filesys_unmount();
 
     return r == FR_OK;
 }
@@ -197,10 +524,33 @@ static bool exec_remove(char const * const command)
         o->name  = str_create_copy(p.name);
         o->count = p.file_len;
         o->bytes = p.buf;
+        o->next = 0;
+        o->gen = 0;
         return o;
     }
 #endif //NDEBUG
 
+/** Load file with given name from current folder, which may also be a D64
+ *  image or a ZIP archive.
+ *
+ * - Caller takes ownership of returned bytes (0 on error).
+ */
+static uint8_t * load_from_cur_dir(
+    char const * const name, uint32_t * const count)
+{
+    // (loading from images and archives supports patterns, like a 1541)
+    //
+    if(d64_is_mounted())
+    {
+        return d64_load(name, count);
+    }
+    if(zip_is_mounted())
+    {
+        return zip_load(name, count);
+    }
+    return filesys_load(s_cur_dir_path, name, count);
+}
+
 static struct cmd_output * exec_load(char const * const command)
 {
 #ifndef NDEBUG
@@ -210,16 +560,75 @@ static struct cmd_output * exec_load(char const * const command)
 #endif
     struct cmd_output * const o = alloc_alloc(sizeof *o);
 
-    o->bytes = filesys_load(s_cur_dir_path, command, &(o->count));
+    o->bytes = load_from_cur_dir(command, &(o->count));
     if(o->bytes == 0)
     {
         alloc_free(o);
         return 0;
     }
     o->name = str_create_copy(command);
+    o->next = 0;
+    o->gen = 0;
     return o;
 }
 
+/** Load all files listed in the (text) file given via command, one file name
+ *  per line, to be sent back-to-back in one fast mode session.
+ *
+ * - List and listed files are loaded from current folder, which may also be a
+ *   D64 image or a ZIP archive.
+ * - Returns 0 on error (e.g. if one of the listed files does not exist).
+ */
+static struct cmd_output * exec_multi(char const * const command)
+{
+    char const * const name_only = command + str_get_len(s_multi);
+    uint32_t count = 0, beg = 0;
+    struct cmd_output * ret_val = 0, * last = 0;
+    uint8_t * const list = load_from_cur_dir(name_only, &count);
+
+    if(list == 0)
+    {
+        return 0;
+    }
+
+    for(uint32_t i = 0;i <= count;++i)
+    {
+        if(i < count && list[i] != '\r' && list[i] != '\n')
+        {
+            continue;
+        }
+
+        if(i > beg) // Ignores empty lines.
+        {
+            char * const name = str_create_partial_copy(
+                (char const *)list, beg, i - beg);
+            struct cmd_output * const o = exec_load(name);
+
+            alloc_free(name);
+            if(o == 0)
+            {
+                cmd_free_output(ret_val);
+                ret_val = 0;
+                break;
+            }
+
+            if(last == 0)
+            {
+                ret_val = o;
+            }
+            else
+            {
+                last->next = o;
+            }
+            last = o;
+        }
+        beg = i + 1;
+    }
+
+    alloc_free(list);
+    return ret_val;
+}
+
 static bool exec_cd(char const * const command)
 {
     bool ret_val = false;
@@ -237,6 +646,9 @@ static bool exec_cd(char const * const command)
 
         if(is_back_cmd)
         {
+            d64_unmount(); // (if mounted, current "folder" is an image)
+            zip_unmount(); // (if mounted, current "folder" is an archive)
+
             int const last_slash_i = str_get_last_index(s_cur_dir_path, '/');
 
             assert(last_slash_i >= 0);
@@ -250,20 +662,34 @@ static bool exec_cd(char const * const command)
         }
         else
         {
-            filesys_remount();
+            if(is_in_image())
+            {
+                break; // (no subfolders in D64 images or ZIP archives)
+            }
+
+            filesys_mount();
             dir_reinit(s_cur_dir_path);
 
-            bool const has_sub_dir = dir_has_sub_dir(name_only);
+            bool const has_sub_dir = dir_has_sub_dir(name_only),
+                is_file = !has_sub_dir && dir_is_file(name_only),
+                is_d64 = is_file && str_is_matching(name_only, "*.d64"),
+                is_zip = is_file && str_is_matching(name_only, "*.zip");
 
             dir_deinit();
-            filesys_unmount();
 
-            if(!has_sub_dir)
+            if(!has_sub_dir && !is_d64 && !is_zip)
             {
                 break;
             }
 
-            buf = dir_create_full_path(s_cur_dir_path, name_only);
+            buf = dir_create_full_path_of_alias(s_cur_dir_path, name_only);
+
+            if((is_d64 && !d64_mount(buf, get_d64_name_char))
+                || (is_zip && !zip_mount(buf)))
+            {
+                alloc_free(buf);
+                break;
+            }
         }
 
         alloc_free(s_cur_dir_path);
@@ -292,6 +718,90 @@ static bool exec_cd(char const * const command)
     return ret_val;
 }
 
+/** Get 16-bit value from string holding exactly four hexadecimal digits.
+ */
+static bool get_word_from_hex(char const * const s, uint16_t * const out)
+{
+    *out = 0;
+    for(int i = 0;i < 4;++i)
+    {
+        char const c = s[i];
+
+        *out <<= 4;
+        if(c >= '0' && c <= '9')
+        {
+            *out |= (uint16_t)(c - '0');
+            continue;
+        }
+        if(c >= 'a' && c <= 'f')
+        {
+            *out |= (uint16_t)(c - 'a' + 10);
+            continue;
+        }
+        if(c >= 'A' && c <= 'F')
+        {
+            *out |= (uint16_t)(c - 'A' + 10);
+            continue;
+        }
+        return false;
+    }
+    return s[4] == '\0';
+}
+
+static bool exec_chan(
+    char const * const command, struct cmd_output * * const output)
+{
+    if(str_starts_with(command, s_chan_addr))
+    {
+        uint16_t addr = 0;
+
+        if(!get_word_from_hex(command + str_get_len(s_chan_addr), &addr))
+        {
+            return false;
+        }
+        cmd_chan_set_addr(addr);
+        return true;
+    }
+    if(str_starts_with(command, s_chan_write))
+    {
+        return cmd_chan_open_write(
+            s_cur_dir_path, command + str_get_len(s_chan_write));
+    }
+    if(str_are_equal(command, s_chan)
+        || str_starts_with(command, s_chan_block))
+    {
+        struct cmd_output * const o = alloc_alloc(sizeof *o);
+
+        if(command[1] == '\0')
+        {
+            o->bytes = cmd_chan_create_next(&(o->count));
+        }
+        else
+        {
+            uint16_t block = 0;
+
+            o->bytes = 0;
+            o->count = 0;
+            if(get_word_from_hex(command + str_get_len(s_chan_block), &block))
+            {
+                o->bytes = cmd_chan_create_block(
+                    (uint32_t)block, &(o->count));
+            }
+        }
+        if(o->bytes == 0)
+        {
+            alloc_free(o);
+            return false;
+        }
+        o->name = str_create_copy(command);
+        o->next = 0;
+        o->gen = 0;
+        *output = o;
+        return true;
+    }
+    return cmd_chan_open_read(s_cur_dir_path, command + str_get_len(s_chan));
+}
+
 static bool exec_mode(char const * const command)
 {
     char const * const name_only = command + str_get_len(s_mode);
@@ -315,81 +825,85 @@ static bool exec_mode(char const * const command)
     return ret_val;
 }
 
+/** Queue save of PRG retrieved from CBM [see filesys_save_queued()], so CBM
+ *  gets released before the file is written to SD card.
+ *
+ * - Does not overwrite an existing file, if overwrite is false.
+ */
 static bool exec_save(
-    char const * const command, struct tape_input const * const ti)
+    char const * const name_only,
+    struct tape_input const * const ti,
+    bool const overwrite)
 {
-    bool ret_val = false,
-        file_is_open = false;
-    FIL fil;
-
-    filesys_remount();
-    dir_reinit(s_cur_dir_path);
+    if(is_in_image())
+    {
+        return false; // (saving into D64 images or ZIP archives is not
+                      // supported)
+    }
 
-    char const * const name_only = command + str_get_len(s_save);
-    char * const full_path = dir_create_full_path(s_cur_dir_path, name_only);
+    uint32_t const count = 2 + ti->len; // (with load address)
+    uint8_t * const bytes = alloc_alloc(count);
 
-    do
+    if(bytes == 0)
     {
-        UINT write_count;
-        uint8_t buf;
+        return false;
+    }
 
-        // (no overwrite)
-        //
-        if(f_open(&fil, full_path, FA_CREATE_NEW | FA_WRITE) != FR_OK)
-        {
-            break;
-        }
-        file_is_open = true;
+    // One buffer, so the file gets written with a single f_write() call:
+    //
+    bytes[0] = (uint8_t)(ti->addr & 0x00FF);
+    bytes[1] = (uint8_t)(ti->addr >> 8);
+    memcpy(bytes + 2, ti->bytes, ti->len);
 
-        buf = (uint8_t)(ti->addr & 0x00FF);
-        if(f_write(&fil, &buf, 1, &write_count) != FR_OK)
-        {
-            break;
-        }
-        if(write_count != 1)
-        {
-            break;
-        }
+    return filesys_save_queued(
+        s_cur_dir_path, name_only, bytes, count, overwrite);
+}
 
-        buf = (uint8_t)(ti->addr >> 8);
-        if(f_write(&fil, &buf, 1, &write_count) != FR_OK)
-        {
-            break;
-        }
-        if(write_count != 1)
-        {
-            break;
-        }
+/** Save RAM snapshot retrieved from CBM to file (overwrites existing file).
+ *
+ * - Output is set to the pointers to be restored at CBM, even on failure
+ *   (see cmd_snap_create_save_reply()).
+ */
+static bool exec_snap_save(
+    enum mode_type const mode,
+    char const * const command,
+    struct tape_input const * const ti,
+    struct cmd_output * * const output)
+{
+    if(!cmd_snap_prepare_save(mode, ti))
+    {
+        return false;
+    }
+    *output = cmd_snap_create_save_reply(mode, command, ti);
 
-        if(f_write(&fil, ti->bytes, ti->len, &write_count) != FR_OK)
-        {
-            break;
-        }
-        if(write_count != ti->len)
-        {
-            break;
-        }
+    return *output != 0
+        && exec_save(command + str_get_len(s_snap_save), ti, true);
+}
 
-        ret_val = true;
-    }while(false);
+static struct cmd_output * exec_snap_restore(
+    enum mode_type const mode, char const * const command)
+{
+    uint32_t count = 0;
+    struct cmd_output * ret_val = 0;
 
-    if(file_is_open)
+    if(!cmd_snap_is_supported(mode))
     {
-        f_close(&fil);
-        file_is_open = false;
+        return 0;
+    }
 
-        if(!ret_val)
-        {
-            f_unlink(name_only);
-        }
+    uint8_t * const bytes = filesys_load(
+        s_cur_dir_path, command + str_get_len(s_snap_restore), &count);
+
+    if(bytes == 0)
+    {
+        return 0;
     }
-    alloc_free(full_path);
-    dir_deinit();
-    filesys_unmount();
+    ret_val = cmd_snap_create_restore(mode, command, bytes, count);
+    alloc_free(bytes);
     return ret_val;
 }
 
-bool cmd_exec(
+static bool exec(
     enum mode_type const mode,
     char const * const command,
     struct tape_input const * const ti,
@@ -402,14 +916,21 @@ bool cmd_exec(
         return false;
     }
 
+    // (if not done by cmd_prefetch(), commands must see it)
+    //
+    if(!filesys_flush())
+    {
+        s_is_save_failed = true;
+    }
+
     if(str_starts_with(command, s_mode))
     {
         return exec_mode(command);
     }
     if(str_starts_with(command, s_dir))
     {
-        *output = exec_dir(mode);
-        return true;
+        *output = exec_dir(mode, command);
+        return *output != 0;
     }
     if(str_starts_with(command, s_rm))
     {
@@ -419,9 +940,66 @@ bool cmd_exec(
     {
         return exec_cd(command);
     }
+    if(str_are_equal(command, s_chan_append)) // (saves "#..." otherwise)
+    {
+        return mode != mode_type_save && cmd_chan_append(ti->bytes, ti->len);
+    }
     if(str_starts_with(command, s_save))
     {
-        return exec_save(command, ti);
+        return exec_save(command + str_get_len(s_save), ti, false);
+    }
+
+    // An existing file wins over an added command with the same prefix,
+    // except for "#" alone (next chunk, see cmd_chan.h), which gets sent
+    // repeatedly:
+    //
+    if(is_added_command(command)
+        && !str_are_equal(command, s_chan)
+        && is_file_in_cur_dir(command))
+    {
+        *output = exec_load(command);
+        return *output != 0;
+    }
+
+    if(str_starts_with(command, s_find_rebuild))
+    {
+        return cmd_index_rebuild(MT_FILESYS_ROOT);
+    }
+    if(str_starts_with(command, s_find))
+    {
+        *output = exec_find(mode, command);
+        return *output != 0;
+    }
+    if(str_starts_with(command, s_load_found))
+    {
+        *output = exec_load_found(command);
+        return *output != 0;
+    }
+    if(str_starts_with(command, s_snap_save))
+    {
+        return exec_snap_save(mode, command, ti, output);
+    }
+    if(str_starts_with(command, s_snap_restore))
+    {
+        *output = exec_snap_restore(mode, command);
+        return *output != 0;
+    }
+    if(str_starts_with(command, s_chan))
+    {
+        if(mode == mode_type_save)
+        {
+            return false; // Programs can't use SAVE and LOAD for this.
+        }
+        return exec_chan(command, output);
+    }
+    if(str_starts_with(command, s_multi))
+    {
+        if(mode == mode_type_save)
+        {
+            return false; // One file per LOAD in compatibility mode.
+        }
+        *output = exec_multi(command);
+        return *output != 0;
     }
 
 #ifndef NDEBUG
@@ -435,18 +1013,77 @@ bool cmd_exec(
     return *output != 0;
 }
 
+bool cmd_exec(
+    enum mode_type const mode,
+    char const * const command,
+    struct tape_input const * const ti,
+    struct cmd_output * * const output)
+{
+    bool const ret_val = exec(mode, command, ti, output);
+
+    if(s_is_save_failed)
+    {
+        // The command of a queued save already succeeded, when writing it
+        // failed, so this command reports the error (its output still gets
+        // sent):
+        //
+        s_is_save_failed = false;
+        return false;
+    }
+    return ret_val;
+}
+
+void cmd_prefetch()
+{
+    if(!filesys_flush()) // (CBM got released, already)
+    {
+        s_is_save_failed = true; // (reported by next command)
+    }
+    cmd_index_sync(); // (stores index, if files got saved or removed)
+    cmd_chan_prefetch();
+}
+
 void cmd_reinit(
     bool (*save_mode)(char const * const),
     char const * const start_dir_path)
 {
     s_save_mode = save_mode;
 
+    cmd_chan_close();
+    filesys_set_on_change(on_change, cmd_index_set);
+    d64_unmount();
+    zip_unmount();
+
     if(s_cur_dir_path != 0)
     {
         alloc_free(s_cur_dir_path);
         s_cur_dir_path = 0;
     }
     s_cur_dir_path = str_create_copy(start_dir_path);
+
+    dir_set_alias_char_func(get_alias_char);
+    cmd_index_init(MT_FILESYS_ROOT); // (file index is kept in RAM)
+}
+
+void cmd_fill_output_bytes(struct cmd_output * const output)
+{
+    if(output->gen == 0)
+    {
+        return; // Nothing to do.
+    }
+
+    output->bytes = alloc_alloc(output->count);
+    for(uint32_t i = 0;i < output->count;++i)
+    {
+        output->bytes[i] = output->gen->next(output->gen->state);
+    }
+
+    if(output->gen->free_state != 0)
+    {
+        output->gen->free_state(output->gen->state);
+    }
+    alloc_free(output->gen);
+    output->gen = 0;
 }
 
 void cmd_free_output(struct cmd_output * const output)
@@ -456,12 +1093,25 @@ void cmd_free_output(struct cmd_output * const output)
         return; // Nothing to do.
     }
 
+    cmd_free_output(output->next);
+    output->next = 0;
+
     alloc_free(output->name);
     output->name = 0;
 
     alloc_free(output->bytes);
     output->bytes = 0;
 
+    if(output->gen != 0)
+    {
+        if(output->gen->free_state != 0)
+        {
+            output->gen->free_state(output->gen->state);
+        }
+        alloc_free(output->gen);
+        output->gen = 0;
+    }
+
     output->count = 0;
 
     alloc_free(output);
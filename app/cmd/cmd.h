@@ -15,6 +15,8 @@
 
 /**
  * - Caller takes ownership of object "returned" via output pointer.
+ * - Also returns false, if writing a queued save of an earlier command failed
+ *   meanwhile (output is set, anyway).
  */
 bool cmd_exec(
     enum mode_type const mode,
@@ -22,12 +24,26 @@ bool cmd_exec(
     struct tape_input const * const ti,
     struct cmd_output * * const output);
 
+/** Do work that can be done while Commodore machine is busy (e.g. writing
+ *  queued saves to SD card and reading ahead for file channel).
+ *
+ * - To be called after output of cmd_exec() got sent.
+ */
+void cmd_prefetch();
+
 void cmd_reinit(
     bool (*save_mode)(char const * const),
     char const * const start_dir_path);
 
+/** Make sure that bytes of given output object (not of following ones) are
+ *  in RAM, by consuming its generator, if any (e.g. to send output via tape
+ *  encoding, which needs all bytes in advance).
+ */
+void cmd_fill_output_bytes(struct cmd_output * const output);
+
 /** Helper method to deallocate output object.
  *
+ *  - Also deallocates following output objects (see next member).
  *  - Given pointer is no longer valid, after this.
  *  - Works with 0 given, too (just does nothing).
  */
@@ -0,0 +1,375 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "cmd_chan.h"
+#include "cmd_index.h"
+#include "../../lib/assert.h"
+#include "../../lib/alloc/alloc.h"
+#include "../../lib/dir/dir.h"
+#include "../../lib/filesys/filesys.h"
+#include "../../lib/filecache/filecache.h"
+#include "../../lib/ff14/source/ff.h"
+#include "../../lib/str/str.h"
+
+#ifndef NDEBUG
+    #include "../../lib/console/console.h"
+#endif //NDEBUG
+
+#include <stdint.h>
+#include <stdbool.h>
+
+static uint16_t s_addr = 0; // CBM destination address of chunks.
+
+static char * s_full_path = 0; // Path of file currently open.
+static bool s_is_write = false;
+static uint32_t s_block = 0; // Index of next chunk to send.
+
+// File open for reading, kept open for the channel's lifetime [until it gets
+// closed, or the file gets saved to or the SD card changed, see
+// cmd_chan_on_change()]:
+//
+static FIL s_fil;
+static bool s_is_open = false;
+
+// Cluster link map table of file open for reading (for FatFs fast seek,
+// making seeking to a chunk not depend on the file's size):
+//
+static DWORD * s_clmt = 0;
+
+// Chunk cache, also used as read-ahead buffer:
+//
+#define MT_CMD_CHAN_CACHE_COUNT 16
+//
+struct chunk
+{
+    bool valid;
+    uint32_t block; // Index of chunk in file.
+    uint32_t len; // (zero <=> end of file)
+    uint32_t last_use;
+    uint8_t bytes[MT_CMD_CHAN_CHUNK_LEN];
+};
+static struct chunk s_cache[MT_CMD_CHAN_CACHE_COUNT];
+static uint32_t s_use = 0; // Incremented on each cache access.
+
+static void clear_cache()
+{
+    for(int i = 0;i < MT_CMD_CHAN_CACHE_COUNT;++i)
+    {
+        s_cache[i].valid = false;
+    }
+    s_use = 0;
+}
+
+/** Return cache entry holding chunk with given index, or 0.
+ */
+static struct chunk * get_cached(uint32_t const block)
+{
+    for(int i = 0;i < MT_CMD_CHAN_CACHE_COUNT;++i)
+    {
+        if(s_cache[i].valid && s_cache[i].block == block)
+        {
+            s_cache[i].last_use = ++s_use;
+            return s_cache + i;
+        }
+    }
+    return 0;
+}
+
+/** Return invalid or least recently used cache entry.
+ */
+static struct chunk * get_free()
+{
+    struct chunk * ret_val = s_cache;
+
+    for(int i = 0;i < MT_CMD_CHAN_CACHE_COUNT;++i)
+    {
+        if(!s_cache[i].valid)
+        {
+            return s_cache + i;
+        }
+        if(s_cache[i].last_use < ret_val->last_use)
+        {
+            ret_val = s_cache + i;
+        }
+    }
+    return ret_val;
+}
+
+/** Create cluster link map table for given file opened for reading.
+ *
+ * - Sets s_clmt and fil's table on success.
+ */
+static bool create_clmt(FIL * const fil)
+{
+    s_clmt = filesys_create_clmt(fil);
+    if(s_clmt == 0)
+    {
+        return false;
+    }
+    fil->cltbl = s_clmt;
+    return true;
+}
+
+static void close_fil()
+{
+    if(s_is_open)
+    {
+        f_close(&s_fil);
+        s_is_open = false;
+    }
+
+    alloc_free(s_clmt);
+    s_clmt = 0;
+}
+
+/** Open file given by s_full_path for reading, with a new cluster link map
+ *  table.
+ */
+static bool open_fil()
+{
+    assert(!s_is_open && s_clmt == 0);
+
+    filesys_mount();
+    if(f_open(&s_fil, s_full_path, FA_READ) != FR_OK)
+    {
+        return false;
+    }
+    s_is_open = true;
+
+    create_clmt(&s_fil); // (falls back to normal seek, if too large)
+    return true;
+}
+
+/** Read chunk with given index into cache, if not already there.
+ *
+ * - (Re-)opens the file, if not open.
+ */
+static struct chunk * read_chunk(uint32_t const block)
+{
+    struct chunk * ret_val = get_cached(block);
+    UINT read_len = 0;
+
+    if(ret_val != 0)
+    {
+        return ret_val;
+    }
+
+    assert(s_full_path != 0 && !s_is_write);
+
+    if(s_is_open || open_fil())
+    {
+        struct chunk * const c = get_free();
+
+        if(f_lseek(&s_fil, (FSIZE_t)block * MT_CMD_CHAN_CHUNK_LEN) == FR_OK
+            && f_read(&s_fil, c->bytes, MT_CMD_CHAN_CHUNK_LEN, &read_len)
+                == FR_OK)
+        {
+            c->valid = true;
+            c->block = block;
+            c->len = (uint32_t)read_len;
+            c->last_use = ++s_use;
+            ret_val = c;
+        }
+        else
+        {
+            close_fil(); // (to be reopened by next try)
+        }
+    }
+
+#ifndef NDEBUG
+    console_write("cmd_chan/read_chunk : Read ");
+    console_write_dword_dec((uint32_t)read_len);
+    console_write(" byte(-s) of chunk ");
+    console_write_dword_dec(block);
+    console_writeline(ret_val != 0 ? "." : ", failed!");
+#endif //NDEBUG
+
+    return ret_val;
+}
+
+static bool open(
+    char const * const dir_path,
+    char const * const name,
+    bool const is_write)
+{
+    cmd_chan_close();
+
+    filesys_mount();
+    s_full_path = dir_create_full_path_of_alias(dir_path, name);
+    if(s_full_path == 0)
+    {
+        return false;
+    }
+    s_is_write = is_write;
+
+    if(!is_write)
+    {
+        if(read_chunk(0) != 0)
+        {
+            return true;
+        }
+        cmd_chan_close();
+        return false;
+    }
+
+    FIL fil;
+    bool ret_val = false;
+
+    filesys_mount();
+    filecache_remove(s_full_path);
+    if(f_open(&fil, s_full_path, FA_CREATE_ALWAYS | FA_WRITE) == FR_OK)
+    {
+        f_close(&fil);
+        dir_index_set(s_full_path, false, 0);
+        cmd_index_set(s_full_path, 0);
+        ret_val = true;
+    }
+
+    if(!ret_val)
+    {
+        cmd_chan_close();
+    }
+    return ret_val;
+}
+
+void cmd_chan_set_addr(uint16_t const addr)
+{
+    s_addr = addr;
+}
+
+bool cmd_chan_open_read(char const * const dir_path, char const * const name)
+{
+    return open(dir_path, name, false);
+}
+
+bool cmd_chan_open_write(char const * const dir_path, char const * const name)
+{
+    return open(dir_path, name, true);
+}
+
+uint8_t* cmd_chan_create_next(uint32_t * const count)
+{
+    *count = 0;
+
+    if(s_addr == 0 || s_full_path == 0 || s_is_write)
+    {
+        return 0;
+    }
+
+    struct chunk const * const c = read_chunk(s_block); // (maybe cached)
+
+    if(c == 0)
+    {
+        return 0;
+    }
+
+    uint8_t * const ret_val = alloc_alloc(2 + 1 + c->len);
+
+    ret_val[0] = (uint8_t)(s_addr & 0x00FF);
+    ret_val[1] = (uint8_t)(s_addr >> 8);
+    ret_val[2] = (uint8_t)c->len;
+    for(uint32_t i = 0;i < c->len;++i)
+    {
+        ret_val[3 + i] = c->bytes[i];
+    }
+    *count = 2 + 1 + c->len;
+
+    if(c->len != 0)
+    {
+        ++s_block; // (reading beyond end of file results in zero length)
+    }
+    return ret_val;
+}
+
+uint8_t* cmd_chan_create_block(
+    uint32_t const block, uint32_t * const count)
+{
+    if(s_full_path == 0 || s_is_write)
+    {
+        *count = 0;
+        return 0;
+    }
+    s_block = block;
+    return cmd_chan_create_next(count);
+}
+
+bool cmd_chan_append(uint8_t const * const bytes, uint32_t const count)
+{
+    bool ret_val = false;
+    FIL fil;
+    UINT write_count = 0;
+
+    if(s_full_path == 0 || !s_is_write)
+    {
+        return false;
+    }
+
+    filesys_mount();
+    filecache_remove(s_full_path);
+    if(f_open(&fil, s_full_path, FA_OPEN_APPEND | FA_WRITE) == FR_OK)
+    {
+        ret_val = f_write(&fil, bytes, (UINT)count, &write_count) == FR_OK
+            && write_count == (UINT)count;
+
+        dir_index_set(s_full_path, false, (uint32_t)f_size(&fil));
+        cmd_index_set(s_full_path, (uint32_t)f_size(&fil));
+        f_close(&fil);
+    }
+
+    return ret_val;
+}
+
+void cmd_chan_prefetch()
+{
+    if(s_full_path == 0 || s_is_write)
+    {
+        return; // Nothing to do.
+    }
+    read_chunk(s_block); // (on error, cmd_chan_create_next() will retry)
+}
+
+void cmd_chan_on_change(char const * const full_path)
+{
+    if(s_full_path == 0 || s_is_write)
+    {
+        return; // Nothing to do.
+    }
+
+    if(full_path != 0)
+    {
+        char * const a = str_create_copy(full_path);
+        char * const b = str_create_copy(s_full_path);
+
+        str_to_upper(a, a); // (FAT file names ignore letter case)
+        str_to_upper(b, b);
+
+        bool const is_same = str_are_equal(a, b);
+
+        alloc_free(a);
+        alloc_free(b);
+
+        if(!is_same)
+        {
+            return;
+        }
+    }
+
+#ifndef NDEBUG
+    console_writeline(
+        "cmd_chan_on_change : Closing file and dropping cached chunks..");
+#endif //NDEBUG
+    close_fil(); // (reopened on next read)
+    clear_cache();
+}
+
+void cmd_chan_close()
+{
+    close_fil();
+
+    alloc_free(s_full_path);
+    s_full_path = 0;
+
+    s_is_write = false;
+    s_block = 0;
+    clear_cache();
+}
@@ -0,0 +1,84 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Singleton (!) for a sequential file channel to be used by (machine language)
+// programs running at Commodore machine in fast mode (see prg_main() in
+// cbm/06-main.asm).
+//
+// - Chunks are read ahead into RAM, while the CBM is busy with the previous
+//   chunk (see cmd_chan_prefetch()).
+// - Chunks can also be accessed randomly (see cmd_chan_create_block()), the
+//   most recently used ones stay cached.
+// - A file opened for reading stays open (with its cluster link map table
+//   for fast seeking) until it gets closed or changed [see
+//   cmd_chan_on_change()].
+
+#ifndef MT_CMD_CHAN
+#define MT_CMD_CHAN
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Maximum count of file content bytes per chunk. Each chunk sent to CBM is
+// prefixed by one byte holding the actual count (zero <=> end of file):
+//
+#define MT_CMD_CHAN_CHUNK_LEN 255
+
+/** Set (CBM) destination address of chunks to-be-sent.
+ */
+void cmd_chan_set_addr(uint16_t const addr);
+
+/** Open file with given name in given folder for reading.
+ *
+ * - Closes file currently open, if any.
+ */
+bool cmd_chan_open_read(char const * const dir_path, char const * const name);
+
+/** Create (or truncate) file with given name in given folder for writing.
+ *
+ * - Closes file currently open, if any.
+ */
+bool cmd_chan_open_write(
+    char const * const dir_path, char const * const name);
+
+/** Return next chunk of file opened for reading as PRG to be sent to CBM.
+ *
+ * - Fills given count with length of return value in byte.
+ * - Caller takes ownership of return value.
+ * - Returns 0 on error (e.g. no file open for reading or address not set).
+ */
+uint8_t* cmd_chan_create_next(uint32_t * const count);
+
+/** Return chunk with given index of file opened for reading as PRG to be
+ *  sent to CBM (index 0 <=> first MT_CMD_CHAN_CHUNK_LEN bytes of file).
+ *
+ * - Next chunk returned by cmd_chan_create_next() will be the one following.
+ * - Fills given count with length of return value in byte.
+ * - Caller takes ownership of return value.
+ * - Returns 0 on error (e.g. no file open for reading or address not set).
+ */
+uint8_t* cmd_chan_create_block(uint32_t const block, uint32_t * const count);
+
+/** Append given bytes to file opened for writing.
+ */
+bool cmd_chan_append(uint8_t const * const bytes, uint32_t const count);
+
+/** Read next chunk into RAM buffer, if a file is open for reading and the
+ *  buffer is not already filled.
+ *
+ * - To be called after sending a chunk to CBM.
+ */
+void cmd_chan_prefetch();
+
+/** To be called with full path of a file right before it gets saved to or
+ *  removed, or with 0, if the SD card may have changed.
+ *
+ * - Closes file open for reading, if it is the given one (or 0 is given) and
+ *   drops its cached chunks, it gets reopened on next read.
+ * - Suitable for filesys_set_on_change().
+ */
+void cmd_chan_on_change(char const * const full_path);
+
+void cmd_chan_close();
+
+#endif //MT_CMD_CHAN
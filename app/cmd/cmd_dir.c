@@ -0,0 +1,884 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "cmd_dir.h"
+#include "cmd_output.h"
+#include "../config.h"
+#include "../../lib/assert.h"
+#include "../../lib/alloc/alloc.h"
+#include "../../lib/str/str.h"
+#include "../../lib/calc/calc.h"
+#include "../../lib/dir/dir.h"
+#include "../../lib/filesys/filesys.h"
+#include "../../lib/basic/basic.h"
+#include "../../lib/petasc/petasc.h"
+
+#ifndef NDEBUG
+    #include "../tape/tape_defines.h"
+    #include "../../lib/console/console.h"
+#endif //NDEBUG
+
+#include <stdint.h>
+#include <stdbool.h>
+
+static char const * const s_prefix_dir = "DIR ";
+static char const * const s_prefix_file = "    ";
+static char const * const s_suffix_dir_dense = "/";
+
+static uint8_t const s_petscii_return = 0x0D;
+static uint8_t const s_petscii_rvs_on = 0x12; // (reset by return)
+
+// Maximum count of characters per print payload (see read_prt in
+// cbm/06-main.asm):
+//
+#define MT_CMD_DIR_PRINT_FRAME_LEN 255
+
+// Byte count of a CBM (disk) block, used for file sizes in dense listing:
+//
+#define MT_CMD_DIR_BLOCK_LEN 254
+
+// Maximum count of entries in one line of dense listing (each one takes at
+// least one character, two quotes and a comma):
+//
+#define MT_CMD_DIR_DENSE_MAX_PER_LINE \
+    ((MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE + 3) / 4)
+
+enum dir_gen_step
+{
+    dir_gen_step_header = 0, // Line with folder path.
+    dir_gen_step_entries = 1, // Lines with subfolders, then files.
+    dir_gen_step_end = 2, // End of program.
+    dir_gen_step_done = 3 // (nothing left to generate)
+};
+
+struct dir_gen
+{
+    char * header;
+    bool is_print; // Characters to print instead of BASIC PRG.
+    enum cmd_dir_layout layout; // (BASIC PRG, only)
+    enum dir_gen_step step;
+
+    uint16_t addr; // Address of next BASIC line to generate.
+    uint32_t line_index;
+
+    // Current line (or load address), sent byte by byte:
+    //
+    uint8_t line[MT_BASIC_PRINT_LEN(MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE)];
+    uint32_t line_len;
+    uint32_t line_pos;
+
+    // Dense layout, only:
+    //
+    char * pending; // Entry not fitting into last line generated (or 0).
+
+    // Entries, either the sorted ones of a folder index [not copied, see
+    // create_gen()] or the ones given by caller, of which the ones matching
+    // the pattern from first up to (not including) lim are listed (paged, if
+    // requested, see set_range()):
+    //
+    struct dir_entry const * const * arr;
+    int arr_len;
+    struct dir_entry * * owned_arr; // Given by caller (0 for folder index).
+    uint32_t index_change_count; // See dir_get_index_change_count().
+    char * pattern; // (0 <=> all entries)
+    int arr_first;
+    int arr_lim;
+    int arr_pos;
+
+    // Print payloads, only:
+    //
+    uint32_t print_left; // Count of characters not sent, yet.
+    uint32_t frame_left; // Count of characters left in current payload.
+    uint32_t frame_addr_pos; // Index of payload address byte to send next.
+};
+
+static bool is_dense(enum cmd_dir_layout const layout)
+{
+    return layout == cmd_dir_layout_dense
+        || layout == cmd_dir_layout_dense_sizes;
+}
+
+/** Return true, if an entry's string with given length fits into line of dense
+ *  listing already holding given count of entries with given sum of lengths.
+ */
+static bool is_fitting(
+    uint32_t const count, uint32_t const len_sum, uint32_t const len)
+{
+    return count == 0
+        || (count < MT_CMD_DIR_DENSE_MAX_PER_LINE
+            && len_sum + len + 3 * count <= MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE);
+}
+
+/** Create decimal string of given value (without leading zeros, at most
+ *  UINT16_MAX).
+ *
+ * - Caller takes ownership of return value.
+ */
+static char * create_dec_str(uint32_t const val)
+{
+    char dec[5 + 1];
+    int i = 0;
+
+    calc_word_to_dec(val > UINT16_MAX ? UINT16_MAX : (uint16_t)val, dec);
+    dec[5] = '\0';
+    while(i < 4 && dec[i] == '0')
+    {
+        ++i; // Skips leading zeros.
+    }
+    return str_create_copy(dec + i);
+}
+
+/** Create string to list for given entry.
+ *
+ * - Caller takes ownership of return value.
+ */
+static char * create_entry_str(
+    bool const is_print,
+    enum cmd_dir_layout const layout,
+    bool const is_dir,
+    char const * const name,
+    uint32_t const size)
+{
+    char * ret_val = 0;
+
+    if(is_print)
+    {
+        ret_val = str_create_copy(name); // (subfolders in reverse)
+    }
+    else if(layout == cmd_dir_layout_names)
+    {
+        ret_val = str_create_copy(name);
+    }
+    else if(!is_dense(layout))
+    {
+        ret_val = str_create_concat(
+            is_dir ? s_prefix_dir : s_prefix_file, name);
+    }
+    else if(is_dir)
+    {
+        ret_val = str_create_concat(name, s_suffix_dir_dense);
+    }
+    else if(layout == cmd_dir_layout_dense_sizes)
+    {
+        char * const dec = create_dec_str(
+            (size + MT_CMD_DIR_BLOCK_LEN - 1) / MT_CMD_DIR_BLOCK_LEN);
+
+        ret_val = str_create_concat_three(dec, " ", name);
+        alloc_free(dec);
+    }
+    else
+    {
+        ret_val = str_create_copy(name);
+    }
+
+    if(str_get_len(ret_val) > MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE)
+    {
+        char * const str = ret_val;
+
+        ret_val = str_create_partial_copy(
+            str, 0, MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE);
+        alloc_free(str);
+    }
+    return ret_val;
+}
+
+/** Fill line buffer with given string as characters to print, preceded by
+ *  reverse on, if requested, and followed by return.
+ */
+static void fill_print(
+    struct dir_gen * const g, bool const is_rvs, char const * const str)
+{
+    uint32_t i = 0;
+
+    if(is_rvs)
+    {
+        g->line[i++] = s_petscii_rvs_on;
+    }
+    for(uint32_t k = 0;str[k] != '\0';++k)
+    {
+        g->line[i++] = (uint8_t)petasc_get_petscii(
+            str[k], MT_PETSCII_REPLACER);
+    }
+    g->line[i++] = s_petscii_return;
+
+    g->line_len = i;
+    g->line_pos = 0;
+}
+
+static void fill_basic(
+    struct dir_gen * const g,
+    char const * const * const str_arr,
+    uint32_t const str_count)
+{
+    g->line_len = basic_fill_prints(
+        g->line,
+        g->addr,
+        g->line_index,
+        str_arr,
+        str_count,
+        MT_PETSCII_REPLACER);
+    g->line_pos = 0;
+
+    g->addr += (uint16_t)g->line_len;
+    ++g->line_index;
+}
+
+static bool is_matching(struct dir_gen const * const g, int const pos)
+{
+    return g->pattern == 0 || str_is_matching(g->arr[pos]->name, g->pattern);
+}
+
+/** Create string of next entry to list (subfolders first, then files).
+ *
+ * - Caller takes ownership of return value.
+ * - Returns 0, if there is no entry left (or on error).
+ */
+static char * create_next_entry_str(
+    struct dir_gen * const g, bool * const is_dir)
+{
+    if(g->owned_arr == 0
+        && g->index_change_count != dir_get_index_change_count())
+    {
+        assert(false); // Folder index changed while listing.
+        g->arr_pos = g->arr_lim;
+    }
+
+    while(g->arr_pos < g->arr_lim)
+    {
+        int const pos = g->arr_pos++;
+
+        if(!is_matching(g, pos))
+        {
+            continue;
+        }
+
+        struct dir_entry const * const e = g->arr[pos];
+
+        *is_dir = e->is_dir;
+        return create_entry_str(
+            g->is_print, g->layout, e->is_dir, e->name, e->size);
+    }
+    g->step = dir_gen_step_end;
+    return 0;
+}
+
+/** Fill line buffer with as many entries as fit into one line of dense
+ *  listing.
+ *
+ * - Returns false, if there is no entry left (or on error).
+ */
+static bool fill_dense_line(struct dir_gen * const g)
+{
+    char * str_arr[MT_CMD_DIR_DENSE_MAX_PER_LINE];
+    uint32_t count = 0, len_sum = 0;
+
+    while(true)
+    {
+        char * str = g->pending;
+
+        g->pending = 0;
+        if(str == 0)
+        {
+            bool is_dir = false;
+
+            str = create_next_entry_str(g, &is_dir);
+            if(str == 0)
+            {
+                break;
+            }
+        }
+
+        uint32_t const len = str_get_len(str);
+
+        if(!is_fitting(count, len_sum, len))
+        {
+            g->pending = str; // Goes to next line.
+            break;
+        }
+        str_arr[count++] = str;
+        len_sum += len;
+    }
+
+    if(count == 0)
+    {
+        return false;
+    }
+
+    fill_basic(g, (char const * const *)str_arr, count);
+    for(uint32_t i = 0;i < count;++i)
+    {
+        alloc_free(str_arr[i]);
+    }
+    return true;
+}
+
+/** Fill line buffer with next entry's line (or next entries' line).
+ *
+ * - Returns false, if there is no entry left (or on error).
+ */
+static bool fill_entry_line(struct dir_gen * const g)
+{
+    if(!g->is_print && is_dense(g->layout))
+    {
+        return fill_dense_line(g);
+    }
+
+    bool is_dir = false;
+    char * const str = create_next_entry_str(g, &is_dir);
+
+    if(str == 0)
+    {
+        return false;
+    }
+    if(g->is_print)
+    {
+        fill_print(g, is_dir, str);
+    }
+    else
+    {
+        fill_basic(g, (char const * const *)&str, 1);
+    }
+    alloc_free(str);
+    return true;
+}
+
+static void fill_next_line(struct dir_gen * const g)
+{
+    switch(g->step)
+    {
+        case dir_gen_step_header:
+        {
+            if(g->is_print)
+            {
+                fill_print(g, false, g->header);
+            }
+            else
+            {
+                fill_basic(g, (char const * const *)&g->header, 1);
+            }
+            g->step = dir_gen_step_entries;
+            return;
+        }
+        case dir_gen_step_entries:
+        {
+            if(fill_entry_line(g))
+            {
+                return;
+            }
+            g->step = dir_gen_step_end; // No more entries.
+            fill_next_line(g);
+            return;
+        }
+        case dir_gen_step_end:
+        {
+            if(g->is_print)
+            {
+                break; // No end of program to send.
+            }
+            g->line[0] = 0; // End of program.
+            g->line[1] = 0; //
+            g->line_len = 2;
+            g->line_pos = 0;
+            g->step = dir_gen_step_done;
+            return;
+        }
+
+        case dir_gen_step_done: // (falls through)
+        default:
+        {
+            break;
+        }
+    }
+
+    // More bytes requested than announced (e.g. because of file system error
+    // during generation), fill up with zeros:
+    //
+    assert(false);
+    g->step = dir_gen_step_done;
+    g->line[0] = 0;
+    g->line_len = 1;
+    g->line_pos = 0;
+}
+
+static uint8_t next_of_line(struct dir_gen * const g)
+{
+    if(g->line_pos == g->line_len)
+    {
+        fill_next_line(g);
+    }
+    return g->line[g->line_pos++];
+}
+
+static uint8_t next(void * const state)
+{
+    struct dir_gen * const g = state;
+
+    if(!g->is_print)
+    {
+        return next_of_line(g);
+    }
+
+    // Each print payload is preceded by its address:
+
+    if(g->frame_addr_pos == 0)
+    {
+        g->frame_left = g->print_left < MT_CMD_DIR_PRINT_FRAME_LEN
+            ? g->print_left : MT_CMD_DIR_PRINT_FRAME_LEN;
+        ++g->frame_addr_pos;
+        return (uint8_t)(MT_CMD_DIR_PRINT_ADDR & 0x00FF);
+    }
+    if(g->frame_addr_pos == 1)
+    {
+        ++g->frame_addr_pos;
+        return (uint8_t)(MT_CMD_DIR_PRINT_ADDR >> 8);
+    }
+
+    assert(g->frame_left > 0);
+
+    --g->print_left;
+    --g->frame_left;
+    if(g->frame_left == 0)
+    {
+        g->frame_addr_pos = 0; // Next payload.
+    }
+    return next_of_line(g);
+}
+
+static void free_state(void * const state)
+{
+    struct dir_gen * const g = state;
+
+    if(g->owned_arr != 0)
+    {
+        dir_free_entry_arr(g->owned_arr, g->arr_len);
+    }
+    alloc_free(g->pattern);
+    alloc_free(g->pending);
+    alloc_free(g->header);
+    alloc_free(g);
+}
+
+/** Fill line buffer with load address, which is sent first.
+ */
+static void fill_load_addr(struct dir_gen * const g)
+{
+    g->line[0] = (uint8_t)(g->addr & 0x00FF);
+    g->line[1] = (uint8_t)(g->addr >> 8);
+    g->line_len = 2;
+    g->line_pos = 0;
+}
+
+/** Return count of bytes of all entries' lines, by generating them once
+ *  (without sending).
+ *
+ * - Resets generator to its header line afterwards.
+ */
+static uint32_t get_entries_len(struct dir_gen * const g)
+{
+    uint16_t const addr = g->addr;
+    uint32_t const line_index = g->line_index;
+    uint32_t ret_val = 0;
+
+    g->step = dir_gen_step_entries;
+    while(fill_entry_line(g))
+    {
+        ret_val += g->line_len;
+    }
+    assert(g->pending == 0);
+
+    g->arr_pos = g->arr_first;
+    g->step = dir_gen_step_header;
+    g->addr = addr;
+    g->line_index = line_index;
+    g->line_len = 0;
+    g->line_pos = 0;
+    return ret_val;
+}
+
+/** Return count of pages of the given count of entries to list and get
+ *  position of first entry on given (one-based) page and of first entry after
+ *  that page (page 0 <=> all entries, page after last one <=> none).
+ */
+static uint32_t get_page_range(
+    struct dir_gen const * const g,
+    int const len,
+    uint32_t const page,
+    int * const first,
+    int * const lim)
+{
+    uint32_t const page_len = g->is_print || !is_dense(g->layout)
+            ? MT_CMD_DIR_PAGE_LEN : MT_CMD_DIR_PAGE_LEN_DENSE,
+        page_count = ((uint32_t)len + page_len - 1) / page_len;
+
+    if(page == 0)
+    {
+        *first = 0;
+        *lim = len;
+        return page_count;
+    }
+    *first = page > page_count ? len : (int)((page - 1) * page_len);
+    *lim = *first + (int)page_len >= len ? len : *first + (int)page_len;
+    return page_count;
+}
+
+/** Set range of entries to list to the ones matching the pattern on given
+ *  (one-based) page (0 <=> all) and return count of pages.
+ */
+static uint32_t set_range(struct dir_gen * const g, uint32_t const page)
+{
+    int len = 0, first = 0, lim = 0, n = 0;
+
+    for(int i = 0;i < g->arr_len;++i)
+    {
+        if(is_matching(g, i))
+        {
+            ++len;
+        }
+    }
+
+    uint32_t const ret_val = get_page_range(g, len, page, &first, &lim);
+
+    g->arr_first = g->arr_len;
+    g->arr_lim = g->arr_len;
+    for(int i = 0;i < g->arr_len && n < lim;++i)
+    {
+        if(!is_matching(g, i))
+        {
+            continue;
+        }
+        if(n == first)
+        {
+            g->arr_first = i;
+        }
+        ++n;
+        if(n == lim)
+        {
+            g->arr_lim = i + 1;
+        }
+    }
+    g->arr_pos = g->arr_first;
+    return ret_val;
+}
+
+/** Create generator state without entries to list, yet.
+ */
+static struct dir_gen * alloc_gen(
+    bool const is_print,
+    enum cmd_dir_layout const layout,
+    uint16_t const addr)
+{
+    struct dir_gen * const g = alloc_alloc(sizeof *g);
+
+    g->header = 0;
+    g->is_print = is_print;
+    g->layout = layout;
+    g->step = dir_gen_step_header;
+    g->addr = addr;
+    g->line_index = 0;
+    g->line_len = 0;
+    g->line_pos = 0;
+    g->pending = 0;
+    g->arr = 0;
+    g->arr_len = 0;
+    g->owned_arr = 0;
+    g->index_change_count = 0;
+    g->pattern = 0;
+    g->arr_first = 0;
+    g->arr_lim = 0;
+    g->arr_pos = 0;
+    g->print_left = 0;
+    g->frame_left = 0;
+    g->frame_addr_pos = 0;
+    return g;
+}
+
+/** Set header of given generator state (taking ownership) and return count of
+ *  bytes (BASIC PRG) or characters (print) it will generate.
+ */
+static uint32_t init_gen(struct dir_gen * const g, char * const header)
+{
+    uint32_t len = 0;
+
+    g->header = header;
+    if(str_get_len(g->header) > MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE)
+    {
+        g->header = str_create_partial_copy(
+            header, 0, MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE);
+        alloc_free(header);
+    }
+
+    if(g->is_print)
+    {
+        len = str_get_len(g->header) + 1 + get_entries_len(g);
+        g->print_left = len;
+        return len;
+    }
+
+    len = 2 // Address.
+        + MT_BASIC_PRINT_LEN(str_get_len(g->header))
+        + get_entries_len(g)
+        + 2; // End of program.
+    fill_load_addr(g);
+    return len;
+}
+
+/** Create header of a listing with given title (e.g. folder path), showing
+ *  given page and count of pages, if page is not 0.
+ *
+ * - Caller takes ownership of return value.
+ */
+static char * create_header(
+    char const * const title, uint32_t const page, uint32_t const page_count)
+{
+    if(page == 0)
+    {
+        return str_create_concat(title, ":");
+    }
+
+    char * const page_str = create_dec_str(page),
+        * const count_str = create_dec_str(page_count),
+        * const prefix = str_create_concat_three(title, ": ", page_str),
+        * const ret_val = str_create_concat_three(prefix, "/", count_str);
+
+    alloc_free(prefix);
+    alloc_free(count_str);
+    alloc_free(page_str);
+    return ret_val;
+}
+
+/** Create generator state with entries of given folder and get count of bytes
+ *  (BASIC PRG) or characters (print) it will generate.
+ *
+ * - Returns 0 on error.
+ */
+static struct dir_gen * create_gen(
+    char const * const dir_path,
+    bool const is_print,
+    enum cmd_dir_layout const layout,
+    uint16_t const addr,
+    char const * const pattern,
+    uint32_t const page,
+    uint32_t * const len)
+{
+    struct dir_gen * g = 0;
+    int count = 0;
+
+    filesys_mount();
+    if(!dir_reinit(dir_path))
+    {
+        dir_deinit();
+        return 0;
+    }
+
+    // Always lists from folder index, so entries are named by their aliases
+    // (names on SD card may be longer than 16 characters):
+    //
+    struct dir_entry const * const * const arr = dir_get_entry_arr(&count);
+
+    dir_deinit(); // Everything needed is in RAM.
+    if(count == -1)
+    {
+        return 0;
+    }
+
+    // The entries are read from the index while sending, which is OK, because
+    // nothing changes indexes before sending finished (checked while
+    // listing):
+    //
+    g = alloc_gen(is_print, layout, addr);
+    g->arr = arr;
+    g->arr_len = count;
+    g->index_change_count = dir_get_index_change_count();
+    g->pattern = pattern == 0 ? 0 : str_create_copy(pattern);
+
+    uint32_t const page_count = set_range(g, page);
+
+    *len = init_gen(g, create_header(dir_path, page, page_count));
+    return g;
+}
+
+static struct cmd_output * create_output(
+    struct dir_gen * const g, uint32_t const count, bool const is_owner)
+{
+    struct cmd_output * const ret_val = alloc_alloc(sizeof *ret_val);
+
+    ret_val->name = str_create_copy("DIRECTORY");
+    ret_val->bytes = 0;
+    ret_val->count = count;
+    ret_val->gen = alloc_alloc(sizeof *ret_val->gen);
+    ret_val->gen->state = g;
+    ret_val->gen->next = next;
+    ret_val->gen->free_state = is_owner ? free_state : 0;
+    ret_val->next = 0;
+    return ret_val;
+}
+
+#ifndef NDEBUG
+/** Write byte count and tape transfer time of listing with given count of
+ *  bytes and of the same listing with one line per entry, for comparison.
+ *
+ * - Expects generator not to have sent anything, yet.
+ */
+static void write_report(struct dir_gen * const g, uint32_t const count)
+{
+    enum cmd_dir_layout const layout = g->layout;
+
+    g->layout = cmd_dir_layout_lines;
+
+    uint32_t const lines_len = get_entries_len(g)
+        + 2 + MT_BASIC_PRINT_LEN(str_get_len(g->header)) + 2;
+
+    g->layout = layout;
+    fill_load_addr(g);
+
+    console_write("cmd_dir/write_report : ");
+    console_write_dword_dec(count);
+    console_write(" byte(-s) take ");
+    console_write_dword_dec(count * (MT_TAPE_CONTENT_BYTE_MICRO / 1000));
+    console_write(" ms via tape, ");
+    console_write_dword_dec(lines_len);
+    console_write(" byte(-s) with one line per entry would take ");
+    console_write_dword_dec(lines_len * (MT_TAPE_CONTENT_BYTE_MICRO / 1000));
+    console_write(" ms (");
+    console_write_dword_dec(lines_len == 0 ? 0 : (100 * count) / lines_len);
+    console_writeline("%).");
+}
+#endif //NDEBUG
+
+struct cmd_output * cmd_dir_create_output(
+    char const * const dir_path,
+    uint16_t const addr,
+    enum cmd_dir_layout const layout,
+    char const * const pattern,
+    uint32_t const page)
+{
+    uint32_t count = 0;
+    struct dir_gen * const g = create_gen(
+        dir_path, false, layout, addr, pattern, page, &count);
+
+    if(g == 0)
+    {
+        return 0;
+    }
+
+#ifndef NDEBUG
+    console_write("cmd_dir_create_output : Listing will have ");
+    console_write_dword_dec(count);
+    console_writeline(" byte(-s).");
+    if(is_dense(layout))
+    {
+        write_report(g, count);
+    }
+#endif //NDEBUG
+
+    return create_output(g, count, true);
+}
+
+/** Create one output per print payload, all sharing the given generator
+ *  (whose state is owned by the first output).
+ */
+static struct cmd_output * create_print_outputs(
+    struct dir_gen * const g, uint32_t const count)
+{
+    uint32_t left = count;
+    struct cmd_output * ret_val = 0, * last = 0;
+
+    do
+    {
+        uint32_t const len = left < MT_CMD_DIR_PRINT_FRAME_LEN
+            ? left : MT_CMD_DIR_PRINT_FRAME_LEN;
+        struct cmd_output * const o = create_output(g, 2 + len, last == 0);
+
+        if(last == 0)
+        {
+            ret_val = o;
+        }
+        else
+        {
+            last->next = o;
+        }
+        last = o;
+        left -= len;
+    }while(left > 0);
+
+    return ret_val;
+}
+
+struct cmd_output * cmd_dir_create_print_output(
+    char const * const dir_path,
+    char const * const pattern,
+    uint32_t const page)
+{
+    uint32_t count = 0;
+    struct dir_gen * const g = create_gen(
+        dir_path, true, cmd_dir_layout_lines, 0, pattern, page, &count);
+
+    if(g == 0)
+    {
+        return 0;
+    }
+
+#ifndef NDEBUG
+    console_write("cmd_dir_create_print_output : Listing will have ");
+    console_write_dword_dec(count);
+    console_writeline(" character(-s).");
+#endif //NDEBUG
+
+    return create_print_outputs(g, count);
+}
+
+/** Create generator state for given entries (taking ownership) with given
+ *  layout, of which the ones on given page are listed.
+ */
+static struct dir_gen * create_arr_gen(
+    struct dir_entry * * const arr,
+    int const arr_len,
+    bool const is_print,
+    enum cmd_dir_layout const layout,
+    uint16_t const addr,
+    uint32_t const page,
+    uint32_t * const page_count)
+{
+    struct dir_gen * const g = alloc_gen(is_print, layout, addr);
+
+    g->arr = (struct dir_entry const * const *)arr;
+    g->arr_len = arr_len;
+    g->owned_arr = arr;
+    *page_count = set_range(g, page);
+    return g;
+}
+
+struct cmd_output * cmd_dir_create_arr_output(
+    char const * const title,
+    struct dir_entry * * const arr,
+    int const arr_len,
+    bool const is_print,
+    uint16_t const addr,
+    enum cmd_dir_layout const layout,
+    uint32_t const page)
+{
+    uint32_t page_count = 0;
+    struct dir_gen * const g = create_arr_gen(
+        arr, arr_len, is_print, layout, addr, page, &page_count);
+    uint32_t const count = init_gen(
+        g, create_header(title, page, page_count));
+
+    return is_print ? create_print_outputs(g, count) : create_output(
+        g, count, true);
+}
+
+struct cmd_output * cmd_dir_create_list_output(
+    char const * const header,
+    struct dir_entry * * const arr,
+    int const arr_len,
+    bool const is_print,
+    uint16_t const addr)
+{
+    uint32_t page_count = 0;
+    struct dir_gen * const g = create_arr_gen(
+        arr, arr_len, is_print, cmd_dir_layout_names, addr, 0, &page_count);
+    uint32_t const count = init_gen(g, str_create_copy(header));
+
+    return is_print ? create_print_outputs(g, count) : create_output(
+        g, count, true);
+}
@@ -0,0 +1,118 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Directory listing as BASIC PRG (one PRINT line per entry) or as characters
+// to be printed by the wedge, generated line by line while sending from the
+// folder's index kept in RAM [see dir_get_entry_arr()].
+
+#ifndef MT_CMD_DIR
+#define MT_CMD_DIR
+
+#include "cmd_output.h"
+#include "../../lib/dir/dir.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Address marking a payload to be printed by the wedge instead of being
+// written to memory (see read_prt in cbm/06-main.asm), limit's low byte is the
+// count of characters:
+//
+#define MT_CMD_DIR_PRINT_ADDR 0xFF00
+
+// Count of entries per page of a paged listing (about one screen):
+//
+#define MT_CMD_DIR_PAGE_LEN 20 // One entry per line.
+#define MT_CMD_DIR_PAGE_LEN_DENSE 80 // Several entries per line.
+
+enum cmd_dir_layout
+{
+    // One PRINT line per entry, subfolders marked by "DIR " prefix:
+    //
+    cmd_dir_layout_lines = 0,
+
+    // As many entries per PRINT line as fit, separated by commas (printed in
+    // columns), subfolders marked by "/" suffix (e.g. to save transfer time
+    // in compatibility mode):
+    //
+    cmd_dir_layout_dense = 1,
+
+    // Dense, with file sizes in blocks of 254 bytes in front of file names:
+    //
+    cmd_dir_layout_dense_sizes = 2,
+
+    // One PRINT line per entry, names only (see cmd_dir_create_list_output()):
+    //
+    cmd_dir_layout_names = 3
+};
+
+/** Return output for listing of given folder with given layout, to be loaded
+ *  to given address.
+ *
+ * - Lists entries whose names match given pattern, only [see
+ *   str_is_matching()], or all entries, if pattern is 0.
+ * - Lists given (one-based) page of these entries, only, or all, if page is 0.
+ * - Directories are listed first, then files, each sorted by name and with
+ *   their aliases as names.
+ * - Entries are read from the folder's index in RAM while sending, without
+ *   copying them, so the file system is not accessed while sending.
+ * - Caller takes ownership of return value.
+ * - Returns 0 on error.
+ */
+struct cmd_output * cmd_dir_create_output(
+    char const * const dir_path,
+    uint16_t const addr,
+    enum cmd_dir_layout const layout,
+    char const * const pattern,
+    uint32_t const page);
+
+/** Return output for listing of given folder to be printed by wedge installed
+ *  at top of memory (leaving the program in memory untouched).
+ *
+ * - One line per entry, subfolders in reverse.
+ * - Chain of outputs (one per print payload) sharing a single generator.
+ * - Same selection and order as
+ *   cmd_dir_create_output().
+ * - Caller takes ownership of return value.
+ * - Returns 0 on error.
+ */
+struct cmd_output * cmd_dir_create_print_output(
+    char const * const dir_path,
+    char const * const pattern,
+    uint32_t const page);
+
+/** Return output listing given entries (e.g. of a D64 image) with given title
+ *  as header, like cmd_dir_create_output() or cmd_dir_create_print_output()
+ *  do for a folder (layout is ignored, if printed by wedge).
+ *
+ * - Lists entries in given order.
+ * - Lists given (one-based) page of the entries, only, or all, if page is 0.
+ * - Takes ownership of given array.
+ * - Caller takes ownership of return value.
+ * - Returns 0 on error.
+ */
+struct cmd_output * cmd_dir_create_arr_output(
+    char const * const title,
+    struct dir_entry * * const arr,
+    int const arr_len,
+    bool const is_print,
+    uint16_t const addr,
+    enum cmd_dir_layout const layout,
+    uint32_t const page);
+
+/** Return output listing the names of the given entries with given header, as
+ *  BASIC PRG to be loaded to given address or to be printed by wedge.
+ *
+ * - One line per entry, in given order.
+ * - Takes ownership of given array.
+ * - Caller takes ownership of return value.
+ * - Returns 0 on error.
+ */
+struct cmd_output * cmd_dir_create_list_output(
+    char const * const header,
+    struct dir_entry * * const arr,
+    int const arr_len,
+    bool const is_print,
+    uint16_t const addr);
+
+#endif //MT_CMD_DIR
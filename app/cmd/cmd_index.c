@@ -0,0 +1,559 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "cmd_index.h"
+#include "../config.h"
+#include "../../lib/assert.h"
+#include "../../lib/alloc/alloc.h"
+#include "../../lib/str/str.h"
+#include "../../lib/calc/calc.h"
+#include "../../lib/petasc/petasc.h"
+#include "../../lib/sort/sort.h"
+#include "../../lib/dir/dir.h"
+#include "../../lib/filesys/filesys.h"
+#include "../../lib/ff14/source/ff.h"
+
+#ifndef NDEBUG
+    #include "../../lib/console/console.h"
+#endif //NDEBUG
+
+#include <stdint.h>
+#include <stdbool.h>
+
+static char const * const s_file_name = "CBMTPI.IDX"; // (8.3 name)
+
+// Count of characters of a normalized name (like tape file names):
+//
+#define MT_CMD_INDEX_NAME_LEN 16
+
+// Maximum depth of subfolders to index (each level keeps a folder open):
+//
+#define MT_CMD_INDEX_MAX_DEPTH 16
+
+struct index_entry
+{
+    char * path; // Full path.
+    uint32_t hash; // Of full path, letter case ignored (see get_hash()).
+    uint32_t size; // In byte.
+    char name[MT_CMD_INDEX_NAME_LEN + 1]; // Normalized file name.
+};
+
+static struct index_entry * s_arr = 0;
+static int s_len = 0;
+static int s_cap = 0;
+static bool s_is_loaded = false;
+
+static char * s_root_path = 0; // Set by cmd_index_init() and rebuild.
+static bool s_is_dirty = false; // Changed since stored.
+static bool s_is_stale = false; // Changed while not loaded (after reset).
+
+static void clear()
+{
+    for(int i = 0;i < s_len;++i)
+    {
+        alloc_free(s_arr[i].path);
+    }
+    alloc_free(s_arr);
+    s_arr = 0;
+    s_len = 0;
+    s_cap = 0;
+    s_is_loaded = false;
+    s_is_dirty = false;
+}
+
+static void set_root_path(char const * const root_path)
+{
+    if(s_root_path == root_path)
+    {
+        return;
+    }
+    alloc_free(s_root_path);
+    s_root_path = str_create_copy(root_path);
+}
+
+static char get_upper(char const c)
+{
+    return 'a' <= c && c <= 'z' ? (char)(c - ('a' - 'A')) : c;
+}
+
+/** Return FNV-1a hash of given path in upper case (FAT file names ignore
+ *  letter case).
+ */
+static uint32_t get_hash(char const * const path)
+{
+    uint32_t ret_val = 2166136261u;
+
+    for(char const * c = path;*c != '\0';++c)
+    {
+        ret_val = (ret_val ^ (uint32_t)(uint8_t)get_upper(*c)) * 16777619u;
+    }
+    return ret_val;
+}
+
+/** Return true, if given paths are equal, letter case ignored.
+ */
+static bool is_same_path(char const * const a, char const * const b)
+{
+    int i = 0;
+
+    while(a[i] != '\0' && get_upper(a[i]) == get_upper(b[i]))
+    {
+        ++i;
+    }
+    return a[i] == b[i];
+}
+
+/** Return index of entry with given full path, or -1.
+ */
+static int find(char const * const full_path)
+{
+    uint32_t const hash = get_hash(full_path);
+
+    for(int i = 0;i < s_len;++i)
+    {
+        if(s_arr[i].hash == hash && is_same_path(s_arr[i].path, full_path))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/** Return true, if given full path is the one of the index file itself.
+ */
+static bool is_index_file(char const * const full_path)
+{
+    if(s_root_path == 0)
+    {
+        return false;
+    }
+
+    char * const path = dir_create_full_path(s_root_path, s_file_name);
+    bool const ret_val = is_same_path(path, full_path);
+
+    alloc_free(path);
+    return ret_val;
+}
+
+/** Fill given buffer with given file name, converted to PETSCII and back to
+ *  ASCII (as it arrives from a Commodore machine) and cut to 16 characters.
+ */
+static void fill_name(char * const out, char const * const file_name)
+{
+    int i = 0;
+
+    for(;i < MT_CMD_INDEX_NAME_LEN && file_name[i] != '\0';++i)
+    {
+        out[i] = petasc_get_ascii(
+            petasc_get_petscii(file_name[i], MT_PETSCII_REPLACER),
+            MT_ASCII_REPLACER);
+    }
+    out[i] = '\0';
+}
+
+/** Add file with given full path (taking ownership) and size to index.
+ */
+static void add(char * const path, uint32_t const size)
+{
+    if(s_len == s_cap)
+    {
+        int const cap = s_cap == 0 ? 64 : 2 * s_cap;
+        struct index_entry * const arr = alloc_alloc(cap * sizeof *arr);
+
+        for(int i = 0;i < s_len;++i)
+        {
+            arr[i] = s_arr[i];
+        }
+        alloc_free(s_arr);
+        s_arr = arr;
+        s_cap = cap;
+    }
+
+    struct index_entry * const e = s_arr + s_len;
+
+    e->path = path;
+    e->hash = get_hash(path);
+    e->size = size;
+    fill_name(e->name, path + str_get_last_index(path, '/') + 1);
+    ++s_len;
+}
+
+/** Add all files in folder at given path and in its subfolders to index.
+ *
+ * - Expects file system to be mounted.
+ */
+static bool add_folder(char const * const path, int const depth)
+{
+    bool ret_val = true;
+    DIR * const d = alloc_alloc(sizeof *d);
+    FILINFO info;
+
+    if(f_opendir(d, path) != FR_OK)
+    {
+        alloc_free(d);
+        return false;
+    }
+
+    while(ret_val)
+    {
+        if(f_readdir(d, &info) != FR_OK)
+        {
+            ret_val = false;
+            break;
+        }
+        if(info.fname[0] == '\0')
+        {
+            break; // Done.
+        }
+        if(info.fname[0] == '.' || (info.fattrib & (AM_HID | AM_SYS)) != 0)
+        {
+            continue;
+        }
+        if(depth == 0 && str_are_equal(info.fname, s_file_name))
+        {
+            continue; // The index itself.
+        }
+        if(filesys_is_journal_file(path, info.fname))
+        {
+            continue; // (files used to commit saves)
+        }
+
+        char * const full_path = dir_create_full_path(path, info.fname);
+
+        if((info.fattrib & AM_DIR) == 0)
+        {
+            add(full_path, (uint32_t)info.fsize);
+            continue;
+        }
+        if(depth < MT_CMD_INDEX_MAX_DEPTH)
+        {
+            ret_val = add_folder(full_path, depth + 1);
+        }
+        alloc_free(full_path);
+    }
+
+    f_closedir(d);
+    alloc_free(d);
+    return ret_val;
+}
+
+/** Store index as text file in given root folder.
+ */
+static bool save(char const * const root_path)
+{
+    uint32_t len = 0, pos = 0;
+
+    for(int i = 0;i < s_len;++i)
+    {
+        len += 10 + 1 + str_get_len(s_arr[i].path) + 1; // Size, space, path
+    }                                                  // and new line.
+
+    char * const buf = alloc_alloc(len + 1);
+
+    for(int i = 0;i < s_len;++i)
+    {
+        calc_dword_to_dec(s_arr[i].size, buf + pos);
+        pos += 10;
+        buf[pos++] = ' ';
+        str_copy(buf + pos, s_arr[i].path);
+        pos += str_get_len(s_arr[i].path);
+        buf[pos++] = '\n';
+    }
+    assert(pos == len);
+
+    bool const ret_val = filesys_save(
+        root_path, s_file_name, (uint8_t const *)buf, len, true);
+
+    alloc_free(buf);
+    return ret_val;
+}
+
+/** Return true, if given path is the full path of a file in given root
+ *  folder or in one of its subfolders.
+ */
+static bool is_in_root(char const * const path, char const * const root_path)
+{
+    uint32_t const root_len = str_get_len(root_path);
+    int const slash = str_get_last_index(path, '/');
+
+    if(slash == -1 || path[slash + 1] == '\0')
+    {
+        return false; // No file name.
+    }
+    for(uint32_t i = 0;i < root_len;++i)
+    {
+        if(get_upper(path[i]) != get_upper(root_path[i]))
+        {
+            return false; // (also handles path being shorter)
+        }
+    }
+    return root_path[root_len - 1] == '/' || path[root_len] == '/';
+}
+
+/** Load index from text file in given root folder.
+ *
+ * - Returns false, if a line is invalid (index file gets rebuilt, then).
+ */
+static bool load(char const * const root_path)
+{
+    uint32_t count = 0, beg = 0;
+    uint8_t * const buf = filesys_load(root_path, s_file_name, &count);
+    bool ret_val = true;
+
+    if(buf == 0)
+    {
+        return false;
+    }
+
+    clear();
+    for(uint32_t i = 0;i <= count;++i)
+    {
+        if(i < count && buf[i] != '\r' && buf[i] != '\n')
+        {
+            continue;
+        }
+        if(i == beg)
+        {
+            beg = i + 1;
+            continue; // Ignores empty line.
+        }
+
+        // Ten digits holding size, a space and the full path (see save()):
+
+        char * const size = i - beg > 10 + 1 && buf[beg + 10] == ' '
+            ? str_create_partial_copy((char const *)buf, beg, 10) : 0;
+        uint32_t const size_val = size == 0
+            ? UINT32_MAX : calc_str_to_dword(size);
+        char * const path = size_val == UINT32_MAX
+            ? 0
+            : str_create_partial_copy(
+                (char const *)buf, beg + 10 + 1, i - beg - 10 - 1);
+
+        alloc_free(size);
+        if(path == 0 || !is_in_root(path, root_path))
+        {
+#ifndef NDEBUG
+            console_write("cmd_index/load : Invalid line at offset ");
+            console_write_dword_dec(beg);
+            console_writeline("!");
+#endif //NDEBUG
+            alloc_free(path);
+            ret_val = false;
+            break;
+        }
+        add(path, size_val);
+
+        beg = i + 1;
+    }
+    alloc_free(buf);
+
+    if(!ret_val)
+    {
+        clear();
+        return false;
+    }
+    s_is_loaded = true;
+    return true;
+}
+
+static int cmp_entry(void const * const a, void const * const b)
+{
+    return str_cmp(
+        (*(struct dir_entry const * const *)a)->name,
+        (*(struct dir_entry const * const *)b)->name);
+}
+
+bool cmd_index_init(char const * const root_path)
+{
+    if(s_is_loaded)
+    {
+        return true;
+    }
+    set_root_path(root_path);
+    if(load(root_path))
+    {
+#ifndef NDEBUG
+        console_write("cmd_index_init : Loaded index with ");
+        console_write_dword_dec((uint32_t)s_len);
+        console_writeline(" file(-s).");
+#endif //NDEBUG
+        return true;
+    }
+    return cmd_index_rebuild(root_path);
+}
+
+bool cmd_index_rebuild(char const * const root_path)
+{
+    set_root_path(root_path);
+    clear();
+
+    filesys_remount(); // (drops everything cached by mount)
+    bool const is_built = add_folder(root_path, 0);
+
+#ifndef NDEBUG
+    console_write("cmd_index_rebuild : Indexed ");
+    console_write_dword_dec((uint32_t)s_len);
+    console_writeline(is_built ? " file(-s)." : " file(-s), failed!");
+#endif //NDEBUG
+
+    if(!is_built)
+    {
+        clear();
+        return false;
+    }
+    s_is_loaded = true;
+    s_is_stale = false;
+    return save(root_path);
+}
+
+void cmd_index_set(char const * const full_path, uint32_t const size)
+{
+    if(is_index_file(full_path))
+    {
+        return;
+    }
+    if(!s_is_loaded)
+    {
+        s_is_stale = s_root_path != 0; // (index file misses this change)
+        return;
+    }
+
+    int const i = find(full_path);
+
+    if(i == -1)
+    {
+        add(str_create_copy(full_path), size);
+    }
+    else
+    {
+        s_arr[i].size = size;
+    }
+    s_is_dirty = true;
+}
+
+void cmd_index_remove(char const * const full_path)
+{
+    if(!s_is_loaded)
+    {
+        s_is_stale = s_root_path != 0; // (index file misses this change)
+        return;
+    }
+
+    int const i = find(full_path);
+
+    if(i == -1)
+    {
+        return;
+    }
+
+    alloc_free(s_arr[i].path);
+    for(int j = i + 1;j < s_len;++j)
+    {
+        s_arr[j - 1] = s_arr[j];
+    }
+    --s_len;
+    s_is_dirty = true;
+}
+
+void cmd_index_reset()
+{
+#ifndef NDEBUG
+    if(s_is_loaded)
+    {
+        console_writeline("cmd_index_reset : Dropping index..");
+    }
+#endif //NDEBUG
+    clear();
+    s_is_stale = false;
+}
+
+bool cmd_index_sync()
+{
+    if(s_root_path == 0)
+    {
+        return false; // Not initialized, yet.
+    }
+
+    filesys_flush(); // (so queued saves are not missed by loading)
+
+    if(!s_is_loaded)
+    {
+        return s_is_stale
+            ? cmd_index_rebuild(s_root_path)
+            : cmd_index_init(s_root_path);
+    }
+    if(!s_is_dirty)
+    {
+        return true; // Nothing to do.
+    }
+
+    bool const ret_val = save(s_root_path);
+
+#ifndef NDEBUG
+    console_write("cmd_index_sync : Stored index with ");
+    console_write_dword_dec((uint32_t)s_len);
+    console_writeline(ret_val ? " file(-s)." : " file(-s), failed!");
+#endif //NDEBUG
+    s_is_dirty = !ret_val;
+    return ret_val;
+}
+
+struct dir_entry * * cmd_index_create_search_arr(
+    char const * const pattern, int * const count, int * const total)
+{
+    struct dir_entry * * ret_val = 0;
+
+    *count = 0;
+    *total = 0;
+    for(int i = 0;i < s_len;++i)
+    {
+        if(!str_is_matching(s_arr[i].name, pattern))
+        {
+            continue;
+        }
+
+        ++*total;
+        if(*count == MT_CMD_INDEX_MAX_RESULTS)
+        {
+            continue; // Just counting.
+        }
+        if(ret_val == 0)
+        {
+            ret_val = alloc_alloc(
+                MT_CMD_INDEX_MAX_RESULTS * sizeof *ret_val);
+        }
+
+        struct dir_entry * const e = alloc_alloc(sizeof *e);
+        int const slash = str_get_last_index(s_arr[i].path, '/');
+        char * const folder = slash == 0
+            ? str_create_copy("/")
+            : str_create_partial_copy(s_arr[i].path, 0, (uint32_t)slash);
+        char * const name = str_create_concat("@", s_arr[i].name);
+
+        e->name = str_create_concat_three(name, " ", folder);
+        e->is_dir = false;
+        e->size = s_arr[i].size;
+        alloc_free(name);
+        alloc_free(folder);
+
+        ret_val[(*count)++] = e;
+    }
+
+    if(ret_val != 0)
+    {
+        sort_ptr_intro((void * *)ret_val, (size_t)*count, cmp_entry);
+    }
+    return ret_val;
+}
+
+char * cmd_index_create_path(char const * const pattern)
+{
+    for(int i = 0;i < s_len;++i)
+    {
+        if(str_is_matching(s_arr[i].name, pattern))
+        {
+            return str_create_copy(s_arr[i].path);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Singleton (!) index of all files on the SD card (in all folders), to find
+// and load files without changing folders.
+//
+// - Each file is indexed with its full path, its size and its name normalized
+//   to how it is entered at a Commodore machine (converted to PETSCII and back,
+//   at most 16 characters).
+// - Stored as text file in root folder (one line per file with its size and
+//   full path), to be available right after the next boot.
+// - Kept up to date on saves and removals [see cmd_index_set() and
+//   cmd_index_remove()], stored again by cmd_index_sync().
+
+#ifndef MT_CMD_INDEX
+#define MT_CMD_INDEX
+
+#include "../../lib/dir/dir.h"
+
+#include <stdbool.h>
+
+// Maximum count of matches returned by cmd_index_create_search_arr():
+//
+#define MT_CMD_INDEX_MAX_RESULTS 64
+
+/** Load index from file stored in given root folder or, if there is none,
+ *  build it and store it there.
+ *
+ * - Does nothing, if index is already in RAM.
+ */
+bool cmd_index_init(char const * const root_path);
+
+/** Build index of all files in given root folder and its subfolders and store
+ *  it in root folder (e.g. after files got added or removed).
+ */
+bool cmd_index_rebuild(char const * const root_path);
+
+/** Add file with given full path and size to index or update its size.
+ *
+ * - Just marks the index file to be rebuilt, if index is not loaded [see
+ *   cmd_index_reset()].
+ * - Suitable for filesys_set_on_change() (does not access SD card).
+ */
+void cmd_index_set(char const * const full_path, uint32_t const size);
+
+/** Remove file with given full path from index.
+ *
+ * - Does not access SD card.
+ */
+void cmd_index_remove(char const * const full_path);
+
+/** Drop index from RAM, e.g. because the SD card got changed.
+ *
+ * - It gets loaded from the (new) card by next cmd_index_sync().
+ */
+void cmd_index_reset();
+
+/** Load index after cmd_index_reset() [or rebuild it, if files got changed
+ *  meanwhile] and store index file, if changed since last stored.
+ *
+ * - To be called when the Commodore machine is not waiting (e.g. after a
+ *   command got executed).
+ */
+bool cmd_index_sync();
+
+/** Return array with one entry per indexed file whose normalized name matches
+ *  given pattern [see str_is_matching()], sorted by name.
+ *
+ * - Entry names are '@', the normalized name, a space and the path of the
+ *   file's folder (e.g. "@PACMAN.PRG /GAMES").
+ * - At most MT_CMD_INDEX_MAX_RESULTS entries, fills given total with count of
+ *   all matches.
+ * - Caller takes ownership of return value (may be 0 for zero count).
+ */
+struct dir_entry * * cmd_index_create_search_arr(
+    char const * const pattern, int * const count, int * const total);
+
+/** Return full path of first indexed file whose normalized name matches given
+ *  pattern, or 0.
+ *
+ * - Caller takes ownership of return value.
+ */
+char * cmd_index_create_path(char const * const pattern);
+
+#endif //MT_CMD_INDEX
@@ -6,11 +6,28 @@
 
 #include <stdint.h>
 
+// Generator to create output's bytes one after another, while sending:
+//
+struct cmd_gen
+{
+    void * state;
+    uint8_t (*next)(void * const state); // Returns next byte.
+
+    // 0, if state is shared with and freed by an earlier output in the same
+    // chain (see next member of cmd_output):
+    //
+    void (*free_state)(void * const state);
+};
+
 struct cmd_output
 {
     char* name;
-    uint8_t* bytes;
-    uint32_t count;
+    uint8_t* bytes; // 0, if generated (see gen).
+    uint32_t count; // (also known in advance, if generated)
+
+    struct cmd_gen * gen; // To be used instead of bytes (or 0).
+
+    struct cmd_output * next; // Next output to send in same session (or 0).
 };
 
 #endif //MT_CMD_OUTPUT
@@ -0,0 +1,306 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "cmd_snap.h"
+#include "cmd_output.h"
+#include "../mode/mode_type.h"
+#include "../tape/tape_input.h"
+#include "../../lib/assert.h"
+#include "../../lib/alloc/alloc.h"
+#include "../../lib/str/str.h"
+
+#ifndef NDEBUG
+    #include "../../lib/console/console.h"
+#endif //NDEBUG
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Addresses of start of BASIC pointer (followed by the pointers to start of
+// variables, arrays, end of arrays, bottom of strings, a temporary one and top
+// of memory) and BASIC input buffer (see cbm/01-basic.asm):
+//
+#define MT_CMD_SNAP_SOBPTR_BASIC1 0x7A
+#define MT_CMD_SNAP_SOBPTR_BASIC2 0x28 // (also BASIC 4)
+#define MT_CMD_SNAP_SOBPTR_VIC_C64 0x2B // (also C16 and Plus/4)
+#define MT_CMD_SNAP_BUF_BASIC1 0x000A
+#define MT_CMD_SNAP_BUF 0x0200
+
+// Offsets of pointers from start of BASIC pointer:
+//
+#define MT_CMD_SNAP_OFF_VARTAB 2
+#define MT_CMD_SNAP_OFF_ARYTAB 4 // (followed by strend and fretop)
+#define MT_CMD_SNAP_OFF_MEMSIZ 12
+
+struct snap_ptrs
+{
+    uint16_t sob;
+    uint16_t vartab;
+    uint16_t arytab;
+    uint16_t strend;
+    uint16_t fretop;
+    uint16_t memsiz;
+};
+
+/**
+ * - Returns false, if snapshots are not supported for given mode.
+ */
+static bool get_addrs(
+    enum mode_type const mode, uint16_t * const sobptr, uint16_t * const buf)
+{
+    switch(mode)
+    {
+        case mode_type_pet1tom:
+        {
+            *sobptr = MT_CMD_SNAP_SOBPTR_BASIC1;
+            *buf = MT_CMD_SNAP_BUF_BASIC1;
+            return true;
+        }
+        case mode_type_pet2tom: // (falls through)
+        case mode_type_pet4tom:
+        {
+            *sobptr = MT_CMD_SNAP_SOBPTR_BASIC2;
+            *buf = MT_CMD_SNAP_BUF;
+            return true;
+        }
+        case mode_type_vic20tom: // (falls through)
+        case mode_type_c64tof: // (falls through)
+        case mode_type_c64tom: // (falls through)
+        case mode_type_tedtom:
+        {
+            *sobptr = MT_CMD_SNAP_SOBPTR_VIC_C64;
+            *buf = MT_CMD_SNAP_BUF;
+            return true;
+        }
+
+        default:
+        {
+            return false; // Tape buffer installs have no space for this
+                          // (and C128 BASIC variables are in bank 1).
+        }
+    }
+}
+
+static uint16_t get_word(uint8_t const * const bytes)
+{
+    return (uint16_t)bytes[0] | ((uint16_t)bytes[1] << 8);
+}
+
+/** Get pointers from given snapshot payload (starting at start of BASIC
+ *  pointer at given address and ending at top of memory) and check them for
+ *  plausibility.
+ */
+static bool get_ptrs(
+    uint16_t const sobptr,
+    uint8_t const * const payload,
+    uint32_t const len,
+    struct snap_ptrs * const ptrs)
+{
+    if(len < MT_CMD_SNAP_OFF_MEMSIZ + 2)
+    {
+        return false;
+    }
+
+    ptrs->sob = get_word(payload);
+    ptrs->vartab = get_word(payload + MT_CMD_SNAP_OFF_VARTAB);
+    ptrs->arytab = get_word(payload + MT_CMD_SNAP_OFF_ARYTAB);
+    ptrs->strend = get_word(payload + MT_CMD_SNAP_OFF_ARYTAB + 2);
+    ptrs->fretop = get_word(payload + MT_CMD_SNAP_OFF_ARYTAB + 4);
+    ptrs->memsiz = get_word(payload + MT_CMD_SNAP_OFF_MEMSIZ);
+
+    return ptrs->sob > sobptr + MT_CMD_SNAP_OFF_MEMSIZ + 1
+        && (uint32_t)(ptrs->memsiz - sobptr) == len
+        && ptrs->sob < ptrs->vartab
+        && ptrs->vartab <= ptrs->arytab
+        && ptrs->arytab <= ptrs->strend
+        && ptrs->strend <= ptrs->fretop
+        && ptrs->fretop <= ptrs->memsiz;
+}
+
+/** Create output to write given bytes to given address at CBM.
+ *
+ * - Caller takes ownership of return value.
+ */
+static struct cmd_output * create_frame(
+    char const * const name,
+    uint16_t const addr,
+    uint8_t const * const bytes,
+    uint32_t const count)
+{
+    struct cmd_output * const o = alloc_alloc(sizeof *o);
+
+    assert(count > 0);
+
+    o->count = 2 + count;
+    o->bytes = alloc_alloc(o->count);
+    o->bytes[0] = (uint8_t)(addr & 0x00FF);
+    o->bytes[1] = (uint8_t)(addr >> 8);
+    for(uint32_t i = 0;i < count;++i)
+    {
+        o->bytes[2 + i] = bytes[i];
+    }
+    o->name = str_create_copy(name);
+    o->next = 0;
+    o->gen = 0;
+    return o;
+}
+
+bool cmd_snap_is_supported(enum mode_type const mode)
+{
+    uint16_t sobptr = 0, buf = 0;
+
+    return get_addrs(mode, &sobptr, &buf);
+}
+
+bool cmd_snap_prepare_save(
+    enum mode_type const mode, struct tape_input const * const ti)
+{
+    uint16_t sobptr = 0, buf = 0;
+
+    if(!get_addrs(mode, &sobptr, &buf)
+        || ti->addr != sobptr
+        || ti->len < MT_CMD_SNAP_OFF_MEMSIZ + 2)
+    {
+        return false;
+    }
+
+    for(int i = 0;i < 2;++i)
+    {
+        uint8_t const b = ti->bytes[MT_CMD_SNAP_OFF_VARTAB + i];
+
+        ti->bytes[MT_CMD_SNAP_OFF_VARTAB + i] =
+            ti->bytes[MT_CMD_SNAP_OFF_MEMSIZ + i];
+        ti->bytes[MT_CMD_SNAP_OFF_MEMSIZ + i] = b;
+    }
+    return true;
+}
+
+struct cmd_output * cmd_snap_create_save_reply(
+    enum mode_type const mode,
+    char const * const name,
+    struct tape_input const * const ti)
+{
+    uint16_t sobptr = 0, buf = 0;
+    struct snap_ptrs ptrs;
+
+    if(!get_addrs(mode, &sobptr, &buf)
+        || !get_ptrs(sobptr, ti->bytes, ti->len, &ptrs))
+    {
+        return 0;
+    }
+
+    // Restore top of memory pointer:
+    //
+    struct cmd_output * const ret_val = create_frame(
+        name,
+        sobptr + MT_CMD_SNAP_OFF_MEMSIZ,
+        ti->bytes + MT_CMD_SNAP_OFF_MEMSIZ,
+        2);
+
+    // Restore start of variables pointer by making it the limit of the last
+    // payload (rewrites the byte right before it with its current value):
+    //
+    ret_val->next = create_frame(
+        name,
+        ptrs.vartab - 1,
+        ti->bytes + (ptrs.vartab - 1 - sobptr),
+        1);
+
+    return ret_val;
+}
+
+struct cmd_output * cmd_snap_create_restore(
+    enum mode_type const mode,
+    char const * const name,
+    uint8_t const * const bytes,
+    uint32_t const count)
+{
+    uint16_t sobptr = 0, buf = 0;
+    struct snap_ptrs ptrs;
+
+    if(!get_addrs(mode, &sobptr, &buf)
+        || count < 2
+        || get_word(bytes) != sobptr
+        || !get_ptrs(sobptr, bytes + 2, count - 2, &ptrs))
+    {
+        return 0;
+    }
+
+    uint8_t const * const payload = bytes + 2;
+    struct cmd_output * ret_val = 0, * last = 0, * o = 0;
+
+#ifndef NDEBUG
+    console_write("cmd_snap_create_restore : Program from 0x");
+    console_write_word(ptrs.sob);
+    console_write(" to 0x");
+    console_write_word(ptrs.vartab);
+    console_write(", variables and arrays up to 0x");
+    console_write_word(ptrs.strend);
+    console_write(", strings from 0x");
+    console_write_word(ptrs.fretop);
+    console_write(" to 0x");
+    console_write_word(ptrs.memsiz);
+    console_writeline(".");
+#endif //NDEBUG
+
+    // Variables and arrays (free space between arrays and strings is skipped):
+    //
+    if(ptrs.strend > ptrs.vartab)
+    {
+        o = create_frame(
+            name,
+            ptrs.vartab,
+            payload + (ptrs.vartab - sobptr),
+            (uint32_t)(ptrs.strend - ptrs.vartab));
+        ret_val = o;
+        last = o;
+    }
+
+    // Strings:
+    //
+    if(ptrs.memsiz > ptrs.fretop)
+    {
+        o = create_frame(
+            name,
+            ptrs.fretop,
+            payload + (ptrs.fretop - sobptr),
+            (uint32_t)(ptrs.memsiz - ptrs.fretop));
+        if(last == 0)
+        {
+            ret_val = o;
+        }
+        else
+        {
+            last->next = o;
+        }
+        last = o;
+    }
+
+    // Pointers to arrays, end of arrays and bottom of strings, copied from
+    // input buffer by the wedge after BASIC's CLR got executed:
+    //
+    o = create_frame(
+        name,
+        buf,
+        payload + MT_CMD_SNAP_OFF_ARYTAB,
+        6);
+    if(last == 0)
+    {
+        ret_val = o;
+    }
+    else
+    {
+        last->next = o;
+    }
+    last = o;
+
+    // Program, must be last to set start of variables pointer as its limit:
+    //
+    last->next = create_frame(
+        name,
+        ptrs.sob,
+        payload + (ptrs.sob - sobptr),
+        (uint32_t)(ptrs.vartab - ptrs.sob));
+
+    return ret_val;
+}
@@ -0,0 +1,56 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// RAM snapshots of Commodore machines in fast mode (wedge installed at top of
+// memory, only), see snp_char and rst_char in cbm/06-main.asm.
+//
+// - A snapshot is stored as PRG, starting at the (zero-page) start of BASIC
+//   pointer and ending at the top of memory (zero-page, stack, system area and
+//   the complete BASIC memory).
+// - Restoring sends back BASIC memory in use (program, variables, arrays and
+//   strings) and BASIC's pointers, but not the zero-page, stack and system
+//   area the wedge itself relies on.
+
+#ifndef MT_CMD_SNAP
+#define MT_CMD_SNAP
+
+#include "cmd_output.h"
+#include "../mode/mode_type.h"
+#include "../tape/tape_input.h"
+
+#include <stdbool.h>
+
+bool cmd_snap_is_supported(enum mode_type const mode);
+
+/** Swap start of variables and top of memory pointers in snapshot retrieved
+ *  from CBM back (the wedge swapped them to be able to send everything up to
+ *  top of memory).
+ *
+ * - Returns false, if given input is not a snapshot for given mode.
+ */
+bool cmd_snap_prepare_save(
+    enum mode_type const mode, struct tape_input const * const ti);
+
+/** Return output to be sent to CBM after snapshot was retrieved (given input
+ *  already prepared via cmd_snap_prepare_save()), to restore the pointers the
+ *  wedge modified.
+ *
+ * - Caller takes ownership of return value.
+ */
+struct cmd_output * cmd_snap_create_save_reply(
+    enum mode_type const mode,
+    char const * const name,
+    struct tape_input const * const ti);
+
+/** Return output to be sent to CBM to restore snapshot given as PRG bytes.
+ *
+ * - Caller takes ownership of return value.
+ * - Returns 0 on error (e.g. not a snapshot for given mode).
+ */
+struct cmd_output * cmd_snap_create_restore(
+    enum mode_type const mode,
+    char const * const name,
+    uint8_t const * const bytes,
+    uint32_t const count);
+
+#endif //MT_CMD_SNAP
@@ -6,6 +6,16 @@
 
 #define MT_HEAP_SIZE (32 * 1024 * 1024) // 32 MB.
 
+#define MT_SECTOR_CACHE_LEN (8 * 1024) // Sectors of 512 byte (4 MB of heap).
+#define MT_SECTOR_CACHE_READ_AHEAD 8 // Sectors.
+
+#define MT_FILE_CACHE_MAX_LEN (MT_HEAP_SIZE / 4) // Bytes of file contents.
+#define MT_FILE_CACHE_ARM_MEM_DIV 16 // Cache at most 1/16 of ARM memory.
+#define MT_FILE_PIN_LIST "CBMTPI.PIN" // Files to cache at boot (in root).
+
+#define MT_SAVE_TMP_FILE "CBMTPI.TMP" // Content of save to commit (in root).
+#define MT_SAVE_JOURNAL_FILE "CBMTPI.JNL" // Path of save to commit (in root).
+
 #define MT_TAPE_GPIO_PIN_NR_READ 10
 #define MT_TAPE_GPIO_PIN_NR_SENSE 9
 #define MT_TAPE_GPIO_PIN_NR_MOTOR 22
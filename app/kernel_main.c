@@ -34,10 +34,16 @@
 #include "../lib/basic/basic.h"
 #include "../lib/basic/basic_addr.h"
 #include "../lib/ff14/source/ff.h"
+#include "../lib/ff14/source/diskio.h"
 #include "../lib/dir/dir.h"
 #include "../lib/filesys/filesys.h"
+#include "../lib/filecache/filecache.h"
 #include "../lib/str/str.h"
 
+#ifndef NDEBUG
+    #include "../lib/sectorcache/sectorcache.h"
+#endif //NDEBUG
+
 #include "tape/tape_init.h"
 #include "tape/tape_input.h"
 #include "petload/petload.h"
@@ -50,6 +56,7 @@
 
 #include "mode/mode.h"
 #include "mode/mode_type.h"
+#include "mode/mode_probe.h"
 
 // #if PERI_BASE == PERI_BASE_PI0AND1
 //     #define VIDEO_SUPPORT 1
@@ -355,7 +362,9 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
             case mode_type_pet4tom: // (falls through)
             case mode_type_vic20tom: // (falls through)
             case mode_type_c64tof: // (falls through)
-            case mode_type_c64tom:
+            case mode_type_c64tom: // (falls through)
+            case mode_type_tedtom: // (falls through)
+            case mode_type_c128tof:
             {
                 return petload_retrieve(); // (must never return 0)
             }
@@ -368,7 +377,28 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
         }
     }
 
-    static void on_failed_cmd(enum mode_type const mode)
+    /** Send given output and following ones to CBM in fast mode, creating
+     *  generated outputs' bytes while sending.
+     */
+    static void send_outputs(struct cmd_output const * const o)
+    {
+        for(struct cmd_output const * cur = o; cur != 0; cur = cur->next)
+        {
+            if(cur->gen != 0)
+            {
+                petload_send_gen(cur->count, cur->gen->next, cur->gen->state);
+                continue;
+            }
+            petload_send(cur->bytes, cur->count);
+        }
+    }
+
+    /**
+     * - Still sends given output in fast mode, if not 0 (e.g. to restore
+     *   pointers at CBM after failing to save a RAM snapshot).
+     */
+    static void on_failed_cmd(
+        enum mode_type const mode, struct cmd_output const * const o)
     {
         console_deb_writeline("on_failed_cmd : Error: Command exec. failed!");
 
@@ -383,8 +413,10 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
             || mode == mode_type_pet2 || mode == mode_type_pet2tom
             || mode == mode_type_pet4 || mode == mode_type_pet4tom
             || mode == mode_type_vic20tom
-            || mode == mode_type_c64tof || mode == mode_type_c64tom)
+            || mode == mode_type_c64tof || mode == mode_type_c64tom
+            || mode == mode_type_tedtom || mode == mode_type_c128tof)
         {
+            send_outputs(o);
             petload_send_nop();
         }
     }
@@ -402,7 +434,10 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
             case mode_type_pet4tom: // (falls through)
             case mode_type_vic20tom: // (falls through)
             case mode_type_c64tof: // (falls through)
-            case mode_type_c64tom:
+            case mode_type_c64tom: // (falls through)
+            case mode_type_tedtom: // (falls through)
+            case mode_type_c128tof: // (falls through)
+            case mode_type_auto:
             {
                 return true;
             }
@@ -457,6 +492,21 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
             return mode_type_vic20tom;
         }
 
+        if(str_starts_with(name, "auto"))
+        {
+            return mode_type_auto;
+        }
+
+        if(str_starts_with(name, "ted"))
+        {
+            return mode_type_tedtom;
+        }
+
+        if(str_starts_with(name, "c128"))
+        {
+            return mode_type_c128tof;
+        }
+
         if(str_starts_with(name, "c64tom"))
         {
             return mode_type_c64tom;
@@ -562,16 +612,90 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
         return s_signal_existed;
     }
 
-    /**
-     * - Returns false, if fastmode installer ran on CBM.
+    /** Return, if fast mode loader for given mode gets installed via the
+     *  two-stage bootstrap (true for all top of memory fast modes).
      */
-    static bool send_petload(enum mode_type const mode)
+    static bool is_two_stage(enum mode_type const mode)
+    {
+        switch(mode)
+        {
+            case mode_type_pet1tom: // (falls through)
+            case mode_type_pet2tom: // (falls through)
+            case mode_type_pet4tom: // (falls through)
+            case mode_type_vic20tom: // (falls through)
+            case mode_type_c64tof: // (falls through)
+            case mode_type_c64tom: // (falls through)
+            case mode_type_tedtom: // (falls through)
+            case mode_type_c128tof:
+            {
+                return true;
+            }
+
+            default:
+            {
+                return false;
+            }
+        }
+    }
+
+    /** Return first stage of two-stage bootstrap for given mode.
+     *
+     * - Caller takes ownership of return value.
+     */
+    static struct tape_input * create_boot(enum mode_type const mode)
+    {
+        switch(mode)
+        {
+            case mode_type_pet1tom:
+            {
+                return petload_create_v1boot();
+            }
+            case mode_type_pet2tom:
+            {
+                return petload_create_v2boot();
+            }
+            case mode_type_pet4tom:
+            {
+                return petload_create_v4boot();
+            }
+            case mode_type_vic20tom:
+            {
+                return petload_create_vic20boot();
+            }
+            case mode_type_c64tof: // (falls through)
+            case mode_type_c64tom:
+            {
+                return petload_create_c64boot();
+            }
+            case mode_type_tedtom:
+            {
+                return petload_create_tedboot();
+            }
+            case mode_type_c128tof:
+            {
+                return petload_create_c128boot();
+            }
+
+            default: // Must not happen.
+            {
+                assert(false);
+                return 0;
+            }
+        }
+    }
+
+    /** Return fast mode loader for given mode.
+     *
+     * - Caller takes ownership of return value.
+     */
+    static struct tape_input * create_petload(enum mode_type const mode)
     {
         assert(mode == mode_type_pet1 || mode == mode_type_pet1tom
             || mode == mode_type_pet2 || mode == mode_type_pet2tom
             || mode == mode_type_pet4 || mode == mode_type_pet4tom
             || mode == mode_type_vic20tom
-            || mode == mode_type_c64tof || mode == mode_type_c64tom);
+            || mode == mode_type_c64tof || mode == mode_type_c64tom
+            || mode == mode_type_tedtom || mode == mode_type_c128tof);
 
         struct tape_input * ti = 0;
     
@@ -627,12 +751,38 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
                 break;
             }
 
+            case mode_type_tedtom:
+            {
+                ti = petload_create_tedtom();
+                break;
+            }
+
+            case mode_type_c128tof:
+            {
+                ti = petload_create_c128tof();
+                break;
+            }
+
             default: // Must not happen.
             {
                 assert(false);
                 break;
             }
         }
+        return ti;
+    }
+
+    /**
+     * - Sends the first stage of the two-stage bootstrap instead of the
+     *   complete fast mode loader, if supported by given mode.
+     *
+     * - Returns false, if fastmode installer (or first stage) ran on CBM.
+     */
+    static bool send_petload(enum mode_type const mode)
+    {
+        struct tape_input * const ti = is_two_stage(mode)
+                                        ? create_boot(mode)
+                                        : create_petload(mode);
 
         s_led_state = led_state_off; // Indicates sending-to-CBM "mode".
     
@@ -667,6 +817,21 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
             if(!send_petload(mode))
             {
                 s_measure_signal = false; // Stop measuring.
+
+                if(is_two_stage(mode))
+                {
+                    struct tape_input * const ti = create_petload(mode);
+
+                    console_deb_writeline(
+                        "send_petload_loop : Sending loader to first stage..");
+
+                    s_led_state = led_state_off;
+                    petload_send_to_boot(ti);
+                    s_led_state = led_state_on;
+
+                    tape_input_free(ti);
+                }
+
                 console_deb_writeline("send_petload_loop : Breaking loop..");
                 return;
             }
@@ -692,6 +857,112 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
         }
     }
 
+    /** Let CBM detect its type by sending the probe BASIC PRG in
+     *  compatibility mode and retrieving the mode name it answers with via
+     *  SAVE (see mode_probe.h).
+     *
+     * - CBM will be waiting for the fast mode loader via LOAD on return, if
+     *   a fast mode got detected.
+     *
+     * - Returns compatibility mode, if CBM was not recognized.
+     */
+    static enum mode_type detect_mode()
+    {
+        //                         "1234567890123456"
+        static char const * const name = "AUTO MODE: RUN";
+        static char const * const prefix = "auto ";
+
+        while(true)
+        {
+            s_led_state = led_state_off; // Indicates sending-to-CBM "mode".
+
+            cbm_send(
+                (uint8_t *)s_mode_probe, // (not modified)
+                name,
+                (uint32_t)(sizeof s_mode_probe / sizeof *s_mode_probe),
+                0);
+
+            s_led_state = led_state_on;
+            //
+            // Indicates waiting-for-command-from-CBM "mode".
+
+            struct tape_input * const ti = wait_for_save();
+
+            if(ti == 0)
+            {
+                continue; // Try again..
+            }
+
+            char * const answer = tape_input_create_str_from_name(ti);
+            enum mode_type mode = mode_type_err;
+
+            if(str_starts_with(answer, prefix))
+            {
+                mode = get_mode(answer + str_get_len(prefix));
+            }
+
+#ifndef NDEBUG
+            console_write("detect_mode : Answer from CBM is \"");
+            console_write(answer);
+            console_write("\", mode value is ");
+            console_write_byte_dec((uint8_t)mode);
+            console_writeline(".");
+#endif //NDEBUG
+
+            alloc_free(answer);
+            tape_input_free(ti);
+
+            if(mode != mode_type_err && mode != mode_type_auto)
+            {
+                return mode;
+            }
+        }
+    }
+
+#ifndef NDEBUG
+    /** Print hit rate of sector cache (since boot).
+     */
+    static void print_cache_stats()
+    {
+        struct sectorcache_stats stats;
+
+        sectorcache_get_stats(&stats);
+
+        uint32_t const count = stats.read_hits + stats.read_misses;
+
+        console_write("cmd_enter : Sector cache hits: ");
+        console_write_dword_dec(stats.read_hits);
+        console_write(" of ");
+        console_write_dword_dec(count);
+        console_write(" (");
+        console_write_dword_dec(
+            count == 0
+                ? 0
+                : (uint32_t)((uint64_t)stats.read_hits * 100 / count));
+        console_write("%), read ahead hits: ");
+        console_write_dword_dec(stats.read_ahead_hits);
+        console_write(" of ");
+        console_write_dword_dec(stats.read_ahead);
+        console_write(", written back: ");
+        console_write_dword_dec(stats.write_backs);
+        console_write(" of ");
+        console_write_dword_dec(stats.writes);
+        console_writeline(".");
+    }
+
+    /** Print milliseconds elapsed since given tick, e.g. to compare time the
+     *  CBM waits for a command with time spent after CBM got released.
+     */
+    static void print_duration(char const * const what, uint32_t const tick)
+    {
+        console_write("cmd_enter : ");
+        console_write(what);
+        console_write(" took ");
+        console_write_dword_dec((armtimer_get_tick() - tick) / 1000);
+        console_writeline(" ms.");
+    }
+#endif //NDEBUG
+
     static void cmd_enter(enum mode_type const mode)
     {
         console_deb_writeline("cmd_enter : Entered function.");
@@ -726,8 +997,14 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
             console_writeline("\".");
 #endif //NDEBUG
 
+#ifndef NDEBUG
+            uint32_t deb_tick = armtimer_get_tick();
+#endif //NDEBUG
             if(cmd_exec(mode, name, ti, &o))
             {
+#ifndef NDEBUG
+                print_duration("Command (CBM waiting)", deb_tick);
+#endif //NDEBUG
                 if(o != 0) // Something to send back to CBM.
                 {
                     s_led_state = led_state_off;
@@ -738,6 +1015,10 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
                     {
                         case mode_type_save:
                         {
+                            assert(o->next == 0); // (one file per LOAD)
+
+                            cmd_fill_output_bytes(o);
+
                             armtimer_busywait_microseconds(1 * 1000 * 1000); // 1s
 
                             cbm_send(o->bytes, o->name, o->count, 0);
@@ -767,9 +1048,16 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
                         case mode_type_pet4tom: // (falls through)
                         case mode_type_vic20tom: // (falls through)
                         case mode_type_c64tof: // (falls through)
-                        case mode_type_c64tom:
+                        case mode_type_c64tom: // (falls through)
+                        case mode_type_tedtom: // (falls through)
+                        case mode_type_c128tof:
                         {
-                            petload_send(o->bytes, o->count);
+                            send_outputs(o);
+
+                            // The wedge waits for more, until it gets a zero
+                            // address:
+                            //
+                            petload_send_nop();
                             break;
                         }
 
@@ -786,7 +1074,8 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
                         || mode == mode_type_pet2 || mode == mode_type_pet2tom
                         || mode == mode_type_pet4 || mode == mode_type_pet4tom
                         || mode == mode_type_vic20tom
-                        || mode == mode_type_c64tof || mode == mode_type_c64tom)
+                        || mode == mode_type_c64tof || mode == mode_type_c64tom
+                        || mode == mode_type_tedtom || mode == mode_type_c128tof)
                     {
                         // Get CBM out of waiting-for-response mode:
                         //
@@ -794,14 +1083,26 @@ void __attribute__((interrupt("IRQ"))) handler_irq()
                     }
                 }
 
+#ifndef NDEBUG
+                deb_tick = armtimer_get_tick();
+#endif //NDEBUG
+                cmd_prefetch(); // (CBM is busy with output, now)
+#ifndef NDEBUG
+                print_duration(
+                    "Queued save(-s) and prefetch (CBM released)", deb_tick);
+#endif //NDEBUG
+
                 s_led_state = led_state_on;
                 //
                 // Indicates waiting-for-command-from-CBM mode.
             }
             else
             {
-                on_failed_cmd(mode); // (sets LED to blinking)
+                on_failed_cmd(mode, o); // (sets LED to blinking)
             }
+#ifndef NDEBUG
+            print_cache_stats();
+#endif //NDEBUG
 
             // Deallocate memory:
 
@@ -894,6 +1195,27 @@ static void irq_armtimer_init()
     // definition of start_timer()].
 }
 
+/** Return count of bytes to use for caching file contents, depending on RAM
+ *  available to the ARM.
+ */
+static uint32_t get_file_cache_len()
+{
+    uint32_t arm_mem_len = 0, ret_val = 0;
+
+    mailbox_read_armmemory(&arm_mem_len);
+    if(arm_mem_len == UINT32_MAX)
+    {
+        return 0; // Disables cache.
+    }
+
+    ret_val = arm_mem_len / MT_FILE_CACHE_ARM_MEM_DIV;
+    if(ret_val > MT_FILE_CACHE_MAX_LEN)
+    {
+        ret_val = MT_FILE_CACHE_MAX_LEN; // (cache uses heap)
+    }
+    return ret_val;
+}
+
 static void init_secondary_cores()
 {
 #if PERI_BASE != PERI_BASE_PI0AND1
@@ -1064,6 +1386,21 @@ void kernel_main(uint32_t r0, uint32_t r1, uint32_t r2)
     //
     alloc_init(&__heap, MT_HEAP_SIZE);
 
+    // Cache SD card sectors (e.g. FAT and directories) in heap:
+    //
+    disk_init_cache(MT_SECTOR_CACHE_LEN, MT_SECTOR_CACHE_READ_AHEAD);
+
+    // Complete a save interrupted by a power cut, if any (saves are queued
+    // and written after CBM got released, see cmd_prefetch()):
+    //
+    filesys_init_journal(
+        MT_FILESYS_ROOT, MT_SAVE_TMP_FILE, MT_SAVE_JOURNAL_FILE);
+
+    // Cache loaded files in heap and load the files to be pinned in cache:
+    //
+    filecache_init(get_file_cache_len());
+    filesys_pin(MT_FILESYS_ROOT, MT_FILE_PIN_LIST);
+
     armtimer_start_one_mhz(); // (not sure, if necessary, here..)
 
     // Initialize for tape transfer:
@@ -1092,22 +1429,36 @@ void kernel_main(uint32_t r0, uint32_t r1, uint32_t r2)
 #else //MT_INTERACTIVE
     {
         enum mode_type mode = get_mode_to_use();
+        bool detected = false;
+
+        if(mode == mode_type_auto)
+        {
+            mode = detect_mode(); // (mode is not saved)
+            detected = true;
+        }
 
 #ifndef NDEBUG
         console_write("kernel_main : Mode to use has value ");
         console_write_byte_dec((uint8_t)mode);
         console_writeline(".");
 #endif //NDEBUG
+        petload_set_level_handshake(mode == mode_type_tedtom);
+
         if(mode == mode_type_pet1 || mode == mode_type_pet1tom
             || mode == mode_type_pet2 || mode == mode_type_pet2tom
             || mode == mode_type_pet4 || mode == mode_type_pet4tom
             || mode == mode_type_vic20tom
-            || mode == mode_type_c64tof || mode == mode_type_c64tom)
+            || mode == mode_type_c64tof || mode == mode_type_c64tom
+            || mode == mode_type_tedtom || mode == mode_type_c128tof)
         {
-            // Wait some time for user to power-on CBM and push
-            // <shift> + <run/stop> for loading:
-            //
-            armtimer_busywait_microseconds(5 * 1000 * 1000); // 5s
+            if(!detected)
+            {
+                // Wait some time for user to power-on CBM and push
+                // <shift> + <run/stop> for loading:
+                //
+                armtimer_busywait_microseconds(5 * 1000 * 1000); // 5s
+            }
+            // Otherwise: Probe PRG is already waiting via LOAD.
 
             send_petload_loop(mode);
         }
@@ -37,7 +37,10 @@ bool mode_save(enum mode_type const type)
         case mode_type_pet4tom: // (falls through)
         case mode_type_vic20tom: // (falls through)
         case mode_type_c64tof: // (falls through)
-        case mode_type_c64tom:
+        case mode_type_c64tom: // (falls through)
+        case mode_type_tedtom: // (falls through)
+        case mode_type_c128tof: // (falls through)
+        case mode_type_auto:
         {
             return cfg_save(s_dir_path, s_filename, (uint8_t)type);
         }
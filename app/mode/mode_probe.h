@@ -0,0 +1,59 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_MODE_PROBE
+#define MT_MODE_PROBE
+
+#include <stdint.h>
+
+// BASIC PRG to detect machine type via reset vector's value and send matching
+// mode name to Pi via SAVE (followed by LOAD of fast mode loader):
+//
+// 10 V=PEEK(65532)+256*PEEK(65533):M$="SAVE":N$="UNKNOWN MACHINE"
+// 20 IF V=64738 THEN M$="C64"
+// 30 IF V=64802 THEN M$="VIC20"
+// 40 IF V=64824 THEN M$="PET1TOM"
+// 50 IF V=64721 THEN M$="PET2TOM"
+// 60 IF V=64790 THEN M$="PET4TOM"
+// 62 IF V=65341 THEN M$="C128"
+// 64 IF V=65526 THEN M$="TED"
+// 70 IF M$="SAVE" THEN PRINT N$;": NO FAST MODE, USING SAVE MODE."
+// 80 SAVE"AUTO "+M$:IF M$<>"SAVE" THEN LOAD
+//
+// How to get byte array from (PRG) file:
+//
+// xxd -i probe.prg > probe.h
+
+static uint8_t const s_mode_probe[344] = {
+  0x01, 0x04, 0x3c, 0x04, 0x0a, 0x00, 0x56, 0xb2, 0xc2, 0x28, 0x36, 0x35,
+  0x35, 0x33, 0x32, 0x29, 0xaa, 0x32, 0x35, 0x36, 0xac, 0xc2, 0x28, 0x36,
+  0x35, 0x35, 0x33, 0x33, 0x29, 0x3a, 0x4d, 0x24, 0xb2, 0x22, 0x53, 0x41,
+  0x56, 0x45, 0x22, 0x3a, 0x4e, 0x24, 0xb2, 0x22, 0x55, 0x4e, 0x4b, 0x4e,
+  0x4f, 0x57, 0x4e, 0x20, 0x4d, 0x41, 0x43, 0x48, 0x49, 0x4e, 0x45, 0x22,
+  0x00, 0x55, 0x04, 0x14, 0x00, 0x8b, 0x20, 0x56, 0xb2, 0x36, 0x34, 0x37,
+  0x33, 0x38, 0x20, 0xa7, 0x20, 0x4d, 0x24, 0xb2, 0x22, 0x43, 0x36, 0x34,
+  0x22, 0x00, 0x70, 0x04, 0x1e, 0x00, 0x8b, 0x20, 0x56, 0xb2, 0x36, 0x34,
+  0x38, 0x30, 0x32, 0x20, 0xa7, 0x20, 0x4d, 0x24, 0xb2, 0x22, 0x56, 0x49,
+  0x43, 0x32, 0x30, 0x22, 0x00, 0x8d, 0x04, 0x28, 0x00, 0x8b, 0x20, 0x56,
+  0xb2, 0x36, 0x34, 0x38, 0x32, 0x34, 0x20, 0xa7, 0x20, 0x4d, 0x24, 0xb2,
+  0x22, 0x50, 0x45, 0x54, 0x31, 0x54, 0x4f, 0x4d, 0x22, 0x00, 0xaa, 0x04,
+  0x32, 0x00, 0x8b, 0x20, 0x56, 0xb2, 0x36, 0x34, 0x37, 0x32, 0x31, 0x20,
+  0xa7, 0x20, 0x4d, 0x24, 0xb2, 0x22, 0x50, 0x45, 0x54, 0x32, 0x54, 0x4f,
+  0x4d, 0x22, 0x00, 0xc7, 0x04, 0x3c, 0x00, 0x8b, 0x20, 0x56, 0xb2, 0x36,
+  0x34, 0x37, 0x39, 0x30, 0x20, 0xa7, 0x20, 0x4d, 0x24, 0xb2, 0x22, 0x50,
+  0x45, 0x54, 0x34, 0x54, 0x4f, 0x4d, 0x22, 0x00, 0xe1, 0x04, 0x3e, 0x00,
+  0x8b, 0x20, 0x56, 0xb2, 0x36, 0x35, 0x33, 0x34, 0x31, 0x20, 0xa7, 0x20,
+  0x4d, 0x24, 0xb2, 0x22, 0x43, 0x31, 0x32, 0x38, 0x22, 0x00, 0xfa, 0x04,
+  0x40, 0x00, 0x8b, 0x20, 0x56, 0xb2, 0x36, 0x35, 0x35, 0x32, 0x36, 0x20,
+  0xa7, 0x20, 0x4d, 0x24, 0xb2, 0x22, 0x54, 0x45, 0x44, 0x22, 0x00, 0x34,
+  0x05, 0x46, 0x00, 0x8b, 0x20, 0x4d, 0x24, 0xb2, 0x22, 0x53, 0x41, 0x56,
+  0x45, 0x22, 0x20, 0xa7, 0x20, 0x99, 0x20, 0x4e, 0x24, 0x3b, 0x22, 0x3a,
+  0x20, 0x4e, 0x4f, 0x20, 0x46, 0x41, 0x53, 0x54, 0x20, 0x4d, 0x4f, 0x44,
+  0x45, 0x2c, 0x20, 0x55, 0x53, 0x49, 0x4e, 0x47, 0x20, 0x53, 0x41, 0x56,
+  0x45, 0x20, 0x4d, 0x4f, 0x44, 0x45, 0x2e, 0x22, 0x00, 0x55, 0x05, 0x50,
+  0x00, 0x94, 0x22, 0x41, 0x55, 0x54, 0x4f, 0x20, 0x22, 0xaa, 0x4d, 0x24,
+  0x3a, 0x8b, 0x20, 0x4d, 0x24, 0xb3, 0xb1, 0x22, 0x53, 0x41, 0x56, 0x45,
+  0x22, 0x20, 0xa7, 0x20, 0x93, 0x00, 0x00, 0x00
+};
+
+#endif //MT_MODE_PROBE
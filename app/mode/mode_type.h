@@ -24,7 +24,14 @@ enum mode_type
     mode_type_vic20tom = 0x20,
 
     mode_type_c64tof = 0x64 + 0x00, // Top of free high memory install.
-    mode_type_c64tom = 0x64 + 0x01  // Top of (BASIC) memory install. 
+    mode_type_c64tom = 0x64 + 0x01, // Top of (BASIC) memory install. 
+
+    mode_type_tedtom = 0x16 + 0x01, // C16 and Plus/4, top of memory install.
+
+    mode_type_c128tof = 0x80, // C128, install below BASIC start.
+
+    mode_type_auto = 0xA0 // Detect machine at each start and use matching fast
+                          // mode (see mode_probe.h).
 };
 
 #endif //MT_MODE_TYPE
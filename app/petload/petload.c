@@ -9,6 +9,15 @@
 #include "petload_vic20tom.h"
 #include "petload_c64tof.h"
 #include "petload_c64tom.h"
+#include "petload_tedtom.h"
+#include "petload_c128tof.h"
+#include "petload_pet1boot.h"
+#include "petload_pet2boot.h"
+#include "petload_pet4boot.h"
+#include "petload_vic20boot.h"
+#include "petload_c64boot.h"
+#include "petload_tedboot.h"
+#include "petload_c128boot.h"
 #include "../config.h"
 #include "../cbm/cbm_send.h"
 #include "../tape/tape_input.h"
@@ -59,6 +68,37 @@ static bool s_send_expected_data_ack_level = false;
 // Set by retrieve_bit() during retrieval (to get initial value before sending)
 // and toggled during send by wait_for_data_ack()
 
+// Set by petload_set_level_handshake():
+//
+static bool s_is_level_handshake = false;
+
+#ifndef NDEBUG
+/** Debug-output transfer rate of given byte count transferred since given
+ *  tick of the one MHz ARM timer.
+ */
+static void deb_write_rate(
+    char const * const prefix, uint32_t const byte_count, uint32_t const tick)
+{
+    uint32_t const milliseconds = (armtimer_get_tick() - tick) / 1000;
+
+    console_write(prefix);
+    console_write(" : Transferred ");
+    console_write_dword_dec(byte_count);
+    console_write(" byte(-s) in ");
+    console_write_dword_dec(milliseconds);
+    console_write(" ms (");
+    console_write_dword_dec(
+        milliseconds == 0 ? 0 : byte_count * 1000 / milliseconds);
+    console_writeline(" bytes/s).");
+}
+#endif //NDEBUG
+
+// Timespan without level change on WRITE line that indicates that the signal
+// sent by the first stage of the two-stage bootstrap is over (the signal
+// toggles the level all ~250us, see cbm/03-boot.asm):
+//
+static uint32_t const s_boot_signal_end_microseconds = 2000;
+
 // *** BASIC v2 / Rev. 3 ROMs: ***
 
 // static uint16_t const s_addr_key_buf_char_count = 158/*0x009E*/;
@@ -113,6 +153,15 @@ static void send_data_ack_pulse()
 {
     static uint32_t const pulse_microseconds = 5;
 
+    if(s_is_level_handshake)
+    {
+        // Toggle level instead (there is no flag at CBM to be set by a
+        // pulse):
+        //
+        gpio_set_output(s_data_ack_to_pet, !gpio_read(s_data_ack_to_pet));
+        return;
+    }
+
     //assert(gpio_read(s_data_ack_to_pet) == !s_data_ack_to_pet_default_level);
     //
     // (inverted, because circuit inverts signal to CBM)
@@ -320,6 +369,80 @@ static struct tape_input * create_tom(
     return ret_val;
 }
 
+/** Create tape input object for the first stage of the two-stage bootstrap.
+ *
+ * - The first stage's code gets stored in the header's additional bytes, the
+ *   content is just a BASIC line calling it via SYS.
+ */
+static struct tape_input * create_boot(
+    uint8_t const * const bytes, int const count, uint16_t const basic_addr)
+{
+    //                               "1234567890123456"
+    static char const * const name = "FASTMODE: RUN   ";
+
+    uint16_t const sys_addr = (((uint16_t)bytes[1]) << 8) | (uint16_t)bytes[0];
+    int const src_byte_count =
+        count
+        - 2; // For leading PRG start address bytes.
+
+    assert(sys_addr == 0x028f/*PET*/ || sys_addr == 0x0351/*VIC 20 & C64*/
+        || sys_addr == 0x0348/*C16 & Plus/4*/ || sys_addr == 0x0b15/*C128*/);
+    assert(src_byte_count <= MT_TAPE_INPUT_ADD_BYTES_LEN);
+
+    struct tape_input * const ret_val = alloc_alloc(sizeof *ret_val);
+    uint32_t len = 0;
+    int i = 0;
+
+    for(i = 0;i < MT_TAPE_INPUT_NAME_LEN;++i)
+    {
+        ret_val->name[i] = (uint8_t)petasc_get_petscii(
+            name[i], MT_PETSCII_REPLACER);
+    }
+
+    tape_input_fill_add_bytes(ret_val->add_bytes);
+    for(i = 0;i < src_byte_count;++i)
+    {
+        ret_val->add_bytes[i] = bytes[i + 2];
+    }
+
+    ret_val->addr = basic_addr;
+    ret_val->bytes = basic_get_sys(basic_addr, sys_addr, true, &len);
+    ret_val->len = (uint16_t)len;
+
+#ifndef NDEBUG
+    console_write("petload/create_boot : Stage one byte count: ");
+    console_write_dword_dec((uint32_t)src_byte_count);
+    console_write(", BASIC line byte count: ");
+    console_write_dword_dec(len);
+    console_writeline(".");
+#endif //NDEBUG
+
+    ret_val->type = tape_filetype_relocatable;
+
+    return ret_val;
+}
+
+/** Wait until the level on GPIO pin with given nr. did not change for given
+ *  amount of microseconds.
+ */
+static void wait_for_stable_level(
+    uint32_t const pin_nr, uint32_t const microseconds)
+{
+    bool last = gpio_read(pin_nr);
+    uint32_t tick = armtimer_get_tick();
+
+    while(armtimer_get_tick() - tick < microseconds)
+    {
+        bool const cur = gpio_read(pin_nr);
+
+        if(cur != last)
+        {
+            last = cur;
+            tick = armtimer_get_tick();
+        }
+    }
+}
+
 void petload_wait_for_data_ready_val(
     bool const wait_for_val, bool const do_make_sure)
 {
@@ -397,6 +520,81 @@ struct tape_input * petload_create_c64tom()
         (int)(sizeof s_petload_c64tom / sizeof *s_petload_c64tom));
 }
 
+struct tape_input * petload_create_tedtom()
+{
+    return create_tom(
+        s_petload_tedtom,
+        (int)(sizeof s_petload_tedtom / sizeof *s_petload_tedtom));
+}
+
+struct tape_input * petload_create_c128tof()
+{
+    return create_tom( // (OK, even if not installed in top of BASIC memory)
+        s_petload_c128tof,
+        (int)(sizeof s_petload_c128tof / sizeof *s_petload_c128tof));
+}
+
+struct tape_input * petload_create_v1boot()
+{
+    return create_boot(
+        s_petload_pet1boot,
+        (int)(sizeof s_petload_pet1boot / sizeof *s_petload_pet1boot),
+        MT_BASIC_ADDR_PET);
+}
+
+struct tape_input * petload_create_v2boot()
+{
+    return create_boot(
+        s_petload_pet2boot,
+        (int)(sizeof s_petload_pet2boot / sizeof *s_petload_pet2boot),
+        MT_BASIC_ADDR_PET);
+}
+
+struct tape_input * petload_create_v4boot()
+{
+    return create_boot(
+        s_petload_pet4boot,
+        (int)(sizeof s_petload_pet4boot / sizeof *s_petload_pet4boot),
+        MT_BASIC_ADDR_PET);
+}
+
+struct tape_input * petload_create_vic20boot()
+{
+    return create_boot(
+        s_petload_vic20boot,
+        (int)(sizeof s_petload_vic20boot / sizeof *s_petload_vic20boot),
+        MT_BASIC_ADDR_VIC);
+}
+
+struct tape_input * petload_create_c64boot()
+{
+    return create_boot(
+        s_petload_c64boot,
+        (int)(sizeof s_petload_c64boot / sizeof *s_petload_c64boot),
+        MT_BASIC_ADDR_C64);
+}
+
+struct tape_input * petload_create_tedboot()
+{
+    return create_boot(
+        s_petload_tedboot,
+        (int)(sizeof s_petload_tedboot / sizeof *s_petload_tedboot),
+        MT_BASIC_ADDR_TED);
+}
+
+struct tape_input * petload_create_c128boot()
+{
+    return create_boot(
+        s_petload_c128boot,
+        (int)(sizeof s_petload_c128boot / sizeof *s_petload_c128boot),
+        MT_BASIC_ADDR_C128);
+}
+
+void petload_set_level_handshake(bool const is_level_handshake)
+{
+    s_is_level_handshake = is_level_handshake;
+}
+
 struct tape_input * petload_retrieve()
 {
     // (motor / data-ready from pet line may be low OR on its way to low)
@@ -417,11 +615,14 @@ struct tape_input * petload_retrieve()
     
     console_writeline(" at CBM..");
 #endif //NDEBUG
-    gpio_set_output(
-        s_data_ack_to_pet,
-        !s_data_ack_to_pet_default_level);
-        //
-        // (inverted, because circuit inverts signal to CBM)
+    if(!s_is_level_handshake) // (otherwise a change would be seen as ack.)
+    {
+        gpio_set_output(
+            s_data_ack_to_pet,
+            !s_data_ack_to_pet_default_level);
+            //
+            // (inverted, because circuit inverts signal to CBM)
+    }
 
 #ifndef NDEBUG
     console_writeline("petload_retrieve : Retrieving \"name\"..");
@@ -469,12 +670,16 @@ struct tape_input * petload_retrieve()
 #endif //NDEBUG
 
         ret_val->bytes = alloc_alloc(ret_val->len * sizeof *ret_val->bytes);
+#ifndef NDEBUG
+        uint32_t const deb_tick = armtimer_get_tick();
+#endif //NDEBUG
         for(uint16_t i = 0;i < ret_val->len; ++i)
         {
             ret_val->bytes[i] = retrieve_byte();
         }
 #ifndef NDEBUG
         console_writeline("petload_retrieve : Retrieved payload byte(-s).");
+        deb_write_rate("petload_retrieve", ret_val->len, deb_tick);
 #endif //NDEBUG
     }
     else
@@ -495,7 +700,8 @@ struct tape_input * petload_retrieve()
     console_writeline("petload_retrieve : Done.");
 #endif //NDEBUG
 
-    assert(gpio_read(s_data_ack_to_pet) != s_data_ack_to_pet_default_level);
+    assert(s_is_level_handshake
+        || gpio_read(s_data_ack_to_pet) != s_data_ack_to_pet_default_level);
     //
     // (inverted, because circuit inverts signal to CBM)
     //
@@ -504,10 +710,13 @@ struct tape_input * petload_retrieve()
     return ret_val;
 }
 
-void petload_send(uint8_t const * const bytes, uint32_t const count)
+void petload_send_gen(
+    uint32_t const count,
+    uint8_t (*next)(void * const state),
+    void * const state)
 {
     assert(count >= 2);
-    assert((bytes == 0) == (count == 2));
+    assert((next == 0) == (count == 2));
 
     // Expected first data-ack.-from-PET level was already set by retrieval
     // that (necessarily) preceded petload_send() call:
@@ -530,7 +739,8 @@ void petload_send(uint8_t const * const bytes, uint32_t const count)
     assert(s_data_ready_to_pet_default_level
         == s_data_ack_to_pet_default_level);
 
-    assert(gpio_read(s_data_ready_to_pet) != s_data_ready_to_pet_default_level);
+    assert(s_is_level_handshake
+        || gpio_read(s_data_ready_to_pet) != s_data_ready_to_pet_default_level);
     //
     // (inverted, because circuit inverts signal to CBM)
 
@@ -538,17 +748,20 @@ void petload_send(uint8_t const * const bytes, uint32_t const count)
 
     if(payload_len != 0)
     {
+        uint8_t const addr_low = next(state),
+            addr_high = next(state);
+
 #ifndef NDEBUG
         console_write("petload_send : Sending address bytes ");
-        console_write_byte(bytes[0]);
+        console_write_byte(addr_low);
         console_write(" and ");
-        console_write_byte(bytes[1]);
+        console_write_byte(addr_high);
         console_writeline("..");
 #endif //NDEBUG
-        send_byte(bytes[0]);
-        send_byte(bytes[1]);
+        send_byte(addr_low);
+        send_byte(addr_high);
 
-        uint16_t const addr = bytes[1] << 8 | bytes[0],
+        uint16_t const addr = addr_high << 8 | addr_low,
             lim = addr + payload_len;
 
 #ifndef NDEBUG
@@ -565,11 +778,16 @@ void petload_send(uint8_t const * const bytes, uint32_t const count)
         console_write("petload_send : Sending ");
         console_write_word_dec(payload_len);
         console_writeline(" payload bytes..");
+
+        uint32_t const deb_tick = armtimer_get_tick();
 #endif //NDEBUG
         for(uint32_t i = 2;i < count; ++i)
         {
-            send_byte(bytes[i]);
+            send_byte(next(state));
         }
+#ifndef NDEBUG
+        deb_write_rate("petload_send", payload_len, deb_tick);
+#endif //NDEBUG
     }
     else
     {
@@ -591,6 +809,60 @@ void petload_send(uint8_t const * const bytes, uint32_t const count)
     console_deb_writeline("petload_send : Done.");
 }
 
+struct arr_reader
+{
+    uint8_t const * bytes;
+    uint32_t i;
+};
+
+static uint8_t read_next(void * const state)
+{
+    struct arr_reader * const r = state;
+
+    return r->bytes[r->i++];
+}
+
+void petload_send(uint8_t const * const bytes, uint32_t const count)
+{
+    struct arr_reader r = { .bytes = bytes, .i = 0 };
+
+    assert((bytes == 0) == (count == 2));
+
+    petload_send_gen(count, bytes == 0 ? 0 : read_next, &r);
+}
+
+void petload_send_to_boot(struct tape_input const * const ti)
+{
+    assert(ti->len > 0);
+    assert(s_data_ack_from_pet == s_data_from_pet);
+
+    // The first stage keeps toggling WRITE for some time after the server
+    // detected its signal:
+    //
+    console_deb_writeline(
+        "petload_send_to_boot : Waiting for stage one's signal to end..");
+    wait_for_stable_level(s_data_ack_from_pet, s_boot_signal_end_microseconds);
+
+    // There was no preceding retrieval, get first expected data-ack. level
+    // from current level (see retrieve_bit()):
+    //
+    s_send_expected_data_ack_level = gpio_read(s_data_ack_from_pet);
+
+    uint32_t const count = 2 + (uint32_t)ti->len;
+    uint8_t * const bytes = alloc_alloc(count);
+
+    bytes[0] = (uint8_t)(ti->addr & 0x00FF);
+    bytes[1] = (uint8_t)(ti->addr >> 8);
+    for(uint32_t i = 2;i < count;++i)
+    {
+        bytes[i] = ti->bytes[i - 2];
+    }
+
+    petload_send(bytes, count);
+
+    alloc_free(bytes);
+}
+
 void petload_send_nop()
 {
     petload_send(0, 2);
@@ -67,6 +67,79 @@ struct tape_input * petload_create_v1tom();
  */
 struct tape_input * petload_create_v1();
 
+/** Return fast mode wedge for C16 and Plus/4, installed at top of BASIC
+ *  memory (below $8000).
+ *
+ * - To be used with petload_set_level_handshake(true).
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_tedtom();
+
+/** Return fast mode wedge for C128 (bank 0, installed below BASIC start at
+ *  $1C01).
+ *
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_c128tof();
+
+/** Return first stage of two-stage bootstrap for PET with BASIC v1.
+ *
+ * - To be used with petload_create_v1tom() and petload_send_to_boot().
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_v1boot();
+
+/** Return first stage of two-stage bootstrap for PET with BASIC v2.
+ *
+ * - To be used with petload_create_v2tom() and petload_send_to_boot().
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_v2boot();
+
+/** Return first stage of two-stage bootstrap for PET with BASIC v4.
+ *
+ * - To be used with petload_create_v4tom() and petload_send_to_boot().
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_v4boot();
+
+/** Return first stage of two-stage bootstrap for VIC 20.
+ *
+ * - To be used with petload_create_vic20tom() and petload_send_to_boot().
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_vic20boot();
+
+/** Return first stage of two-stage bootstrap for C64.
+ *
+ * - To be used with petload_create_c64tof() or petload_create_c64tom() and
+ *   petload_send_to_boot().
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_c64boot();
+
+/** Return first stage of two-stage bootstrap for C16 and Plus/4.
+ *
+ * - To be used with petload_create_tedtom() and petload_send_to_boot().
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_tedboot();
+
+/** Return first stage of two-stage bootstrap for C128.
+ *
+ * - To be used with petload_create_c128tof() and petload_send_to_boot().
+ * - Caller takes ownership of returned object.
+ */
+struct tape_input * petload_create_c128boot();
+
+/** Let READ line (data-ack. to CBM) toggle its level instead of using pulses.
+ *
+ * - Necessary for C16 and Plus/4, because their cassette READ line has no
+ *   flag to be set by an edge, but can only be sampled by the wedge.
+ * - The READ line's default levels are not asserted, if enabled.
+ */
+void petload_set_level_handshake(bool const is_level_handshake);
+
 /**
  * - It does NOT matter, if CBM is sending data and waiting for ACK first or if
  *   Pi is waiting for data [petload_retrieve() already called] first.
@@ -110,9 +183,35 @@ struct tape_input * petload_retrieve();
  *
  * - READ line is expected to be on its default level (HIGH) when calling this
  *   function. Preceding call of petload_retrieve() makes sure of that.
+ *
+ * - May be called multiple times in a row, the wedge keeps retrieving until
+ *   petload_send_nop() got called.
  */
 void petload_send(uint8_t const * const bytes, uint32_t const count);
 
+/** Like petload_send(), but gets the given count of bytes (address first) one
+ *  after another from given function while sending (e.g. to not create a
+ *  large output in RAM first).
+ *
+ * - Given function and state are not used, if count is 2 (sends zero
+ *   address).
+ */
+void petload_send_gen(
+    uint32_t const count,
+    uint8_t (*next)(void * const state),
+    void * const state);
+
+/** Send given (top of memory) fast loader to first stage of two-stage
+ *  bootstrap running at CBM.
+ *
+ * - To be called after the first stage's signal got detected.
+ * - Waits for the signal to end.
+ * - READ line is expected to be on its default level (HIGH) when calling this
+ *   function (tape sending makes sure of that).
+ * - Does not take ownership of given object.
+ */
+void petload_send_to_boot(struct tape_input const * const ti);
+
 void petload_send_nop();
 
 #endif //MT_PETLOAD
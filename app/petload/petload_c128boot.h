@@ -0,0 +1,27 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_PETLOAD_C128BOOT
+#define MT_PETLOAD_C128BOOT
+
+#include <stdint.h>
+
+// How to get byte array from (PRG) file:
+//
+// xxd -i c128boot.prg > c128boot.h
+
+static uint8_t const s_petload_c128boot[128] = {
+  0x15, 0x0b, 0x78, 0xa0, 0xff, 0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0xa2,
+  0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf2, 0x2c, 0x0d, 0xdc, 0x20, 0x74,
+  0x0b, 0x85, 0xfa, 0x20, 0x74, 0x0b, 0x85, 0xfb, 0x20, 0x74, 0x0b, 0x8d,
+  0x10, 0x12, 0x20, 0x74, 0x0b, 0x8d, 0x11, 0x12, 0x20, 0x74, 0x0b, 0x81,
+  0xfa, 0xe6, 0xfa, 0xd0, 0x02, 0xe6, 0xfb, 0xa5, 0xfa, 0xcd, 0x10, 0x12,
+  0xd0, 0xee, 0xa5, 0xfb, 0xcd, 0x11, 0x12, 0xd0, 0xe7, 0x20, 0x24, 0x1c,
+  0xa2, 0x04, 0xbd, 0x6f, 0x0b, 0x9d, 0x00, 0x02, 0xca, 0x10, 0xf7, 0xa9,
+  0x00, 0x85, 0x3d, 0xa9, 0x02, 0x85, 0x3e, 0x60, 0x3a, 0x9c, 0x00, 0x00,
+  0x00, 0xa2, 0x08, 0xa9, 0x10, 0x2c, 0x0d, 0xdc, 0xf0, 0xfb, 0xa5, 0x01,
+  0x29, 0x10, 0xc9, 0x10, 0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0x6e, 0x83,
+  0x03, 0xca, 0xd0, 0xe7, 0xad, 0x83, 0x03, 0x60
+};
+
+#endif //MT_PETLOAD_C128BOOT
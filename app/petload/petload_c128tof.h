@@ -0,0 +1,62 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_PETLOAD_C128TOF
+#define MT_PETLOAD_C128TOF
+
+#include <stdint.h>
+
+// How to get byte array from (PRG) file:
+//
+// xxd -i c128tof.prg > c128tof.h
+
+static uint8_t const s_petload_c128tof[549] = {
+  0x01, 0x1c, 0x22, 0x1c, 0x9d, 0x1d, 0x9e, 0x37, 0x32, 0x30, 0x34, 0x3a,
+  0x8f, 0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x32, 0x31, 0x2c, 0x20,
+  0x52, 0x48, 0x49, 0x4e, 0x4f, 0x44, 0x45, 0x56, 0x45, 0x4c, 0x00, 0x00,
+  0x00, 0xa9, 0x55, 0x85, 0xfa, 0xa9, 0x1c, 0x85, 0xfb, 0xa9, 0x31, 0x85,
+  0xfc, 0xa9, 0x1a, 0x85, 0xfd, 0xa0, 0x00, 0xb1, 0xfa, 0x91, 0xfc, 0xe6,
+  0xfa, 0xd0, 0x02, 0xe6, 0xfb, 0xe6, 0xfc, 0xd0, 0x02, 0xe6, 0xfd, 0xa5,
+  0xfa, 0xc9, 0x24, 0xd0, 0xea, 0xa5, 0xfb, 0xc9, 0x1e, 0xd0, 0xe4, 0x4c,
+  0x31, 0x1a, 0xa9, 0x4c, 0x8d, 0x80, 0x03, 0xa9, 0x56, 0x8d, 0x81, 0x03,
+  0xa9, 0x1a, 0x8d, 0x82, 0x03, 0x78, 0xa0, 0xff, 0xa5, 0x01, 0x49, 0x08,
+  0x85, 0x01, 0xa2, 0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf2, 0x58, 0x60,
+  0x4c, 0x6d, 0x1b, 0xe6, 0x3d, 0xd0, 0x02, 0xe6, 0x3e, 0x8c, 0x83, 0x03,
+  0xa4, 0x3e, 0xc0, 0x02, 0xd0, 0x28, 0xa4, 0x3d, 0xd0, 0x24, 0xb1, 0x3d,
+  0xc9, 0x21, 0xd0, 0x1e, 0xe6, 0x3d, 0xb1, 0x3d, 0xf0, 0x0c, 0x99, 0x43,
+  0x1a, 0xc8, 0xc0, 0x10, 0xd0, 0xf4, 0xb1, 0x3d, 0xd0, 0x0c, 0xa9, 0x20,
+  0xc0, 0x10, 0xf0, 0x0c, 0x99, 0x43, 0x1a, 0xc8, 0xd0, 0xf6, 0xac, 0x83,
+  0x03, 0x4c, 0x86, 0x03, 0x78, 0xa9, 0x00, 0x8d, 0x00, 0xff, 0x85, 0xfa,
+  0x85, 0xfb, 0xaa, 0xad, 0x43, 0x1a, 0xc9, 0x2b, 0xd0, 0x08, 0xa5, 0x2d,
+  0x85, 0xfa, 0xa5, 0x2e, 0x85, 0xfb, 0x2c, 0x0d, 0xdc, 0xbc, 0x43, 0x1a,
+  0x20, 0xbe, 0x1b, 0xe8, 0xe0, 0x10, 0xd0, 0xf5, 0xa4, 0xfa, 0x20, 0xbe,
+  0x1b, 0xa4, 0xfb, 0x20, 0xbe, 0x1b, 0xa5, 0xfa, 0xd0, 0x04, 0xa5, 0xfb,
+  0xf0, 0x2c, 0xac, 0x10, 0x12, 0x20, 0xbe, 0x1b, 0xac, 0x11, 0x12, 0x20,
+  0xbe, 0x1b, 0x8d, 0x01, 0xff, 0xb1, 0xfa, 0x8c, 0x00, 0xff, 0xa8, 0x20,
+  0xbe, 0x1b, 0xe6, 0xfa, 0xd0, 0x02, 0xe6, 0xfb, 0xa5, 0xfa, 0xcd, 0x10,
+  0x12, 0xd0, 0xe7, 0xa5, 0xfb, 0xcd, 0x11, 0x12, 0xd0, 0xe0, 0x20, 0xe1,
+  0x1b, 0x85, 0xfa, 0x20, 0xe1, 0x1b, 0x85, 0xfb, 0xd0, 0x04, 0xa5, 0xfa,
+  0xf0, 0x4b, 0xa5, 0xfb, 0xc9, 0xff, 0xd0, 0x18, 0x20, 0xe1, 0x1b, 0x85,
+  0xfb, 0x20, 0xe1, 0x1b, 0x20, 0xe1, 0x1b, 0x20, 0xd2, 0xff, 0xe6, 0xfa,
+  0xa5, 0xfa, 0xc5, 0xfb, 0xd0, 0xf2, 0xf0, 0xd2, 0x20, 0xe1, 0x1b, 0x8d,
+  0x10, 0x12, 0x20, 0xe1, 0x1b, 0x8d, 0x11, 0x12, 0x20, 0xe1, 0x1b, 0x8d,
+  0x01, 0xff, 0x81, 0xfa, 0x8e, 0x00, 0xff, 0xe6, 0xfa, 0xd0, 0x02, 0xe6,
+  0xfb, 0xa5, 0xfa, 0xcd, 0x10, 0x12, 0xd0, 0xe8, 0xa5, 0xfb, 0xcd, 0x11,
+  0x12, 0xd0, 0xe1, 0xf0, 0xa5, 0x58, 0x20, 0x8b, 0x1b, 0xa9, 0x9c, 0x8d,
+  0x00, 0x02, 0xa9, 0x00, 0x8d, 0x01, 0x02, 0xa9, 0x00, 0x85, 0x3d, 0xa9,
+  0x02, 0x85, 0x3e, 0x4c, 0x86, 0x03, 0xad, 0x10, 0x12, 0x48, 0xad, 0x11,
+  0x12, 0x48, 0xa9, 0x60, 0x8d, 0x55, 0x1b, 0x20, 0x93, 0x1a, 0xa9, 0x20,
+  0x8d, 0x55, 0x1b, 0x68, 0x8d, 0x11, 0x12, 0x68, 0x8d, 0x10, 0x12, 0x60,
+  0xa5, 0x2d, 0x85, 0xfa, 0xa5, 0x2e, 0x85, 0xfb, 0x8d, 0x01, 0xff, 0xa0,
+  0x01, 0xb1, 0xfa, 0xf0, 0x1e, 0xa0, 0x04, 0xc8, 0xb1, 0xfa, 0xd0, 0xfb,
+  0xc8, 0x98, 0x18, 0x65, 0xfa, 0xa0, 0x00, 0x91, 0xfa, 0xaa, 0xa5, 0xfb,
+  0x69, 0x00, 0xc8, 0x91, 0xfa, 0x86, 0xfa, 0x85, 0xfb, 0xd0, 0xdc, 0x8d,
+  0x00, 0xff, 0x60, 0x8c, 0x83, 0x03, 0xa0, 0x08, 0xa5, 0x01, 0x29, 0xf7,
+  0x4e, 0x83, 0x03, 0x90, 0x02, 0x09, 0x08, 0x85, 0x01, 0xa5, 0x01, 0x49,
+  0x20, 0x85, 0x01, 0xa9, 0x10, 0x2c, 0x0d, 0xdc, 0xf0, 0xfb, 0x88, 0xd0,
+  0xe3, 0x60, 0xa2, 0x08, 0xa9, 0x10, 0x2c, 0x0d, 0xdc, 0xf0, 0xfb, 0xa5,
+  0x01, 0x29, 0x10, 0xc9, 0x10, 0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0x6e,
+  0x83, 0x03, 0xca, 0xd0, 0xe7, 0xad, 0x83, 0x03, 0x60
+};
+
+#endif //MT_PETLOAD_C128TOF
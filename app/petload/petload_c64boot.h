@@ -0,0 +1,25 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_PETLOAD_C64BOOT
+#define MT_PETLOAD_C64BOOT
+
+#include <stdint.h>
+
+// How to get byte array from (PRG) file:
+//
+// xxd -i c64boot.prg > c64boot.h
+
+static uint8_t const s_petload_c64boot[106] = {
+  0x51, 0x03, 0x78, 0xa0, 0xff, 0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0xa2,
+  0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf2, 0x2c, 0x0d, 0xdc, 0x20, 0x9c,
+  0x03, 0x85, 0x77, 0x20, 0x9c, 0x03, 0x85, 0x78, 0x20, 0x9c, 0x03, 0x85,
+  0x2d, 0x20, 0x9c, 0x03, 0x85, 0x2e, 0x20, 0x9c, 0x03, 0x81, 0x77, 0xe6,
+  0x77, 0xd0, 0x02, 0xe6, 0x78, 0xa5, 0x77, 0xc5, 0x2d, 0xd0, 0xef, 0xa5,
+  0x78, 0xc5, 0x2e, 0xd0, 0xe9, 0x20, 0x24, 0x08, 0x20, 0x59, 0xa6, 0x20,
+  0x33, 0xa5, 0x4c, 0x74, 0xa4, 0xa2, 0x08, 0xa9, 0x10, 0x2c, 0x0d, 0xdc,
+  0xf0, 0xfb, 0xa5, 0x01, 0x29, 0x10, 0xc9, 0x10, 0xa5, 0x01, 0x49, 0x08,
+  0x85, 0x01, 0x66, 0x76, 0xca, 0xd0, 0xe8, 0xa5, 0x76, 0x60
+};
+
+#endif //MT_PETLOAD_C64BOOT
@@ -10,49 +10,63 @@
 //
 // xxd -i c64tom.prg > c64tom.h
 
-static uint8_t const s_petload_c64tom[494] = {
+static uint8_t const s_petload_c64tom[663] = {
   0x01, 0x08, 0x22, 0x08, 0x9d, 0x1d, 0x9e, 0x32, 0x30, 0x38, 0x34, 0x3a,
   0x8f, 0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x32, 0x31, 0x2c, 0x20,
   0x52, 0x48, 0x49, 0x4e, 0x4f, 0x44, 0x45, 0x56, 0x45, 0x4c, 0x00, 0x00,
-  0x00, 0xa6, 0x37, 0xa4, 0x38, 0x38, 0x8a, 0xe9, 0x1f, 0x8d, 0x22, 0x09,
-  0x8d, 0x34, 0x09, 0x8d, 0xfd, 0x08, 0x8d, 0x0f, 0x09, 0x85, 0x37, 0x98,
-  0xe9, 0x01, 0x8d, 0x23, 0x09, 0x8d, 0x35, 0x09, 0x8d, 0xfe, 0x08, 0x8d,
-  0x10, 0x09, 0x85, 0x38, 0x38, 0x8a, 0xe9, 0x0f, 0x8d, 0xc4, 0x08, 0x98,
-  0xe9, 0x01, 0x8d, 0xc8, 0x08, 0x38, 0x8a, 0xe9, 0x40, 0x8d, 0x37, 0x09,
-  0x8d, 0x41, 0x09, 0x8d, 0x46, 0x09, 0x8d, 0x53, 0x09, 0x8d, 0x58, 0x09,
-  0x8d, 0x5e, 0x09, 0x98, 0xe9, 0x00, 0x8d, 0x38, 0x09, 0x8d, 0x42, 0x09,
-  0x8d, 0x47, 0x09, 0x8d, 0x54, 0x09, 0x8d, 0x59, 0x09, 0x8d, 0x5f, 0x09,
-  0x38, 0x8a, 0xe9, 0x1f, 0x8d, 0x73, 0x09, 0x8d, 0x78, 0x09, 0x8d, 0x83,
-  0x09, 0x8d, 0x88, 0x09, 0x8d, 0x8d, 0x09, 0x98, 0xe9, 0x00, 0x8d, 0x74,
-  0x09, 0x8d, 0x79, 0x09, 0x8d, 0x84, 0x09, 0x8d, 0x89, 0x09, 0x8d, 0x8e,
-  0x09, 0xa9, 0xde, 0x85, 0x5f, 0xa9, 0x08, 0x85, 0x60, 0xa9, 0xed, 0x85,
-  0x5a, 0xa9, 0x09, 0x85, 0x5b, 0x86, 0x58, 0x84, 0x59, 0x20, 0xbf, 0xa3,
-  0xa9, 0x4c, 0x85, 0x73, 0xa9, 0xde, 0x85, 0x74, 0xa9, 0x08, 0x85, 0x75,
-  0x78, 0xa0, 0xff, 0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0xa2, 0x2f, 0xca,
-  0xd0, 0xfd, 0x88, 0xd0, 0xf2, 0x58, 0x60, 0xe6, 0x7a, 0xd0, 0x02, 0xe6,
+  0x00, 0xa6, 0x37, 0xa4, 0x38, 0x38, 0x8a, 0xe9, 0x83, 0x8d, 0x6a, 0x09,
+  0x8d, 0x94, 0x09, 0x8d, 0x45, 0x09, 0x8d, 0x57, 0x09, 0x8d, 0x2b, 0x0a,
+  0x85, 0x37, 0x98, 0xe9, 0x01, 0x8d, 0x6b, 0x09, 0x8d, 0x95, 0x09, 0x8d,
+  0x46, 0x09, 0x8d, 0x58, 0x09, 0x8d, 0x2c, 0x0a, 0x85, 0x38, 0x38, 0x8a,
+  0xe9, 0x70, 0x8d, 0x09, 0x09, 0x98, 0xe9, 0x01, 0x8d, 0x0d, 0x09, 0x38,
+  0x8a, 0xe9, 0x3e, 0x8d, 0x97, 0x09, 0x8d, 0xa1, 0x09, 0x8d, 0xa6, 0x09,
+  0x8d, 0xb3, 0x09, 0x8d, 0xb8, 0x09, 0x8d, 0xbe, 0x09, 0x98, 0xe9, 0x00,
+  0x8d, 0x98, 0x09, 0x8d, 0xa2, 0x09, 0x8d, 0xa7, 0x09, 0x8d, 0xb4, 0x09,
+  0x8d, 0xb9, 0x09, 0x8d, 0xbf, 0x09, 0x38, 0x8a, 0xe9, 0x1d, 0x8d, 0xd3,
+  0x09, 0x8d, 0xd8, 0x09, 0x8d, 0x01, 0x0a, 0x8d, 0x06, 0x0a, 0x8d, 0x0b,
+  0x0a, 0x8d, 0xe9, 0x09, 0x8d, 0xee, 0x09, 0x8d, 0xf1, 0x09, 0x98, 0xe9,
+  0x00, 0x8d, 0xd4, 0x09, 0x8d, 0xd9, 0x09, 0x8d, 0x02, 0x0a, 0x8d, 0x07,
+  0x0a, 0x8d, 0x0c, 0x0a, 0x8d, 0xea, 0x09, 0x8d, 0xef, 0x09, 0x8d, 0xf2,
+  0x09, 0x38, 0x8a, 0xe9, 0x58, 0x8d, 0x24, 0x09, 0x98, 0xe9, 0x00, 0x8d,
+  0x25, 0x09, 0x38, 0x8a, 0xe9, 0x35, 0x8d, 0x4a, 0x0a, 0x98, 0xe9, 0x01,
+  0x8d, 0x4b, 0x0a, 0x38, 0x8a, 0xe9, 0x72, 0x8d, 0x47, 0x0a, 0x8d, 0x4f,
+  0x0a, 0x98, 0xe9, 0x00, 0x8d, 0x48, 0x0a, 0x8d, 0x50, 0x0a, 0xa9, 0x23,
+  0x85, 0x5f, 0xa9, 0x09, 0x85, 0x60, 0xa9, 0x96, 0x85, 0x5a, 0xa9, 0x0a,
+  0x85, 0x5b, 0x86, 0x58, 0x84, 0x59, 0x20, 0xbf, 0xa3, 0xa9, 0x4c, 0x85,
+  0x73, 0xa9, 0x26, 0x85, 0x74, 0xa9, 0x09, 0x85, 0x75, 0x78, 0xa0, 0xff,
+  0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0xa2, 0x2f, 0xca, 0xd0, 0xfd, 0x88,
+  0xd0, 0xf2, 0x58, 0x60, 0x4c, 0x3e, 0x0a, 0xe6, 0x7a, 0xd0, 0x02, 0xe6,
   0x7b, 0x84, 0x76, 0xa4, 0x7b, 0xc0, 0x02, 0xd0, 0x28, 0xa4, 0x7a, 0xd0,
   0x24, 0xb1, 0x7a, 0xc9, 0x21, 0xd0, 0x1e, 0xe6, 0x7a, 0xb1, 0x7a, 0xf0,
-  0x0c, 0x99, 0xce, 0x08, 0xc8, 0xc0, 0x10, 0xd0, 0xf4, 0xb1, 0x7a, 0xd0,
-  0x0c, 0xa9, 0x20, 0xc0, 0x10, 0xf0, 0x0b, 0x99, 0xce, 0x08, 0xc8, 0xd0,
+  0x0c, 0x99, 0x13, 0x09, 0xc8, 0xc0, 0x10, 0xd0, 0xf4, 0xb1, 0x7a, 0xd0,
+  0x0c, 0xa9, 0x20, 0xc0, 0x10, 0xf0, 0x0b, 0x99, 0x13, 0x09, 0xc8, 0xd0,
   0xf6, 0xa4, 0x76, 0x4c, 0x79, 0x00, 0x78, 0xa9, 0x00, 0x85, 0x77, 0x85,
-  0x78, 0xaa, 0xad, 0xce, 0x08, 0xc9, 0x2b, 0xd0, 0x08, 0xa5, 0x2b, 0x85,
-  0x77, 0xa5, 0x2c, 0x85, 0x78, 0x2c, 0x0d, 0xdc, 0xbc, 0xce, 0x08, 0x20,
-  0xad, 0x09, 0xe8, 0xe0, 0x10, 0xd0, 0xf5, 0xa4, 0x77, 0x20, 0xad, 0x09,
-  0xa4, 0x78, 0x20, 0xad, 0x09, 0xa5, 0x77, 0xd0, 0x04, 0xa5, 0x78, 0xf0,
-  0x22, 0xa4, 0x2d, 0x20, 0xad, 0x09, 0xa4, 0x2e, 0x20, 0xad, 0x09, 0xb1,
-  0x77, 0xa8, 0x20, 0xad, 0x09, 0xe6, 0x77, 0xd0, 0x02, 0xe6, 0x78, 0xa5,
+  0x78, 0xaa, 0xad, 0x13, 0x09, 0xc9, 0x3e, 0xd0, 0x14, 0xa9, 0x2b, 0x85,
+  0x77, 0xa2, 0x01, 0xb5, 0x2d, 0xb4, 0x37, 0x94, 0x2d, 0x95, 0x37, 0xca,
+  0x10, 0xf5, 0xe8, 0xf0, 0x0c, 0xc9, 0x2b, 0xd0, 0x08, 0xa5, 0x2b, 0x85,
+  0x77, 0xa5, 0x2c, 0x85, 0x78, 0x2c, 0x0d, 0xdc, 0xbc, 0x13, 0x09, 0x20,
+  0x58, 0x0a, 0xe8, 0xe0, 0x10, 0xd0, 0xf5, 0xa4, 0x77, 0x20, 0x58, 0x0a,
+  0xa4, 0x78, 0x20, 0x58, 0x0a, 0xa5, 0x77, 0xd0, 0x04, 0xa5, 0x78, 0xf0,
+  0x22, 0xa4, 0x2d, 0x20, 0x58, 0x0a, 0xa4, 0x2e, 0x20, 0x58, 0x0a, 0xb1,
+  0x77, 0xa8, 0x20, 0x58, 0x0a, 0xe6, 0x77, 0xd0, 0x02, 0xe6, 0x78, 0xa5,
   0x77, 0xc5, 0x2d, 0xd0, 0xee, 0xa5, 0x78, 0xc5, 0x2e, 0xd0, 0xe8, 0x20,
-  0xce, 0x09, 0x85, 0x77, 0x20, 0xce, 0x09, 0x85, 0x78, 0xd0, 0x04, 0xa5,
-  0x77, 0xf0, 0x21, 0x20, 0xce, 0x09, 0x85, 0x2d, 0x20, 0xce, 0x09, 0x85,
-  0x2e, 0x20, 0xce, 0x09, 0x81, 0x77, 0xe6, 0x77, 0xd0, 0x02, 0xe6, 0x78,
-  0xa5, 0x77, 0xc5, 0x2d, 0xd0, 0xef, 0xa5, 0x78, 0xc5, 0x2e, 0xd0, 0xe9,
-  0x58, 0x20, 0x59, 0xa6, 0x20, 0x33, 0xa5, 0x4c, 0x74, 0xa4, 0x84, 0x76,
-  0xa0, 0x08, 0x46, 0x76, 0xa5, 0x01, 0x29, 0xf7, 0x90, 0x02, 0x09, 0x08,
-  0x85, 0x01, 0xa5, 0x01, 0x49, 0x20, 0x85, 0x01, 0xad, 0x0d, 0xdc, 0x29,
-  0x10, 0xf0, 0xf9, 0x88, 0xd0, 0xe4, 0x60, 0xa2, 0x08, 0xad, 0x0d, 0xdc,
-  0x29, 0x10, 0xf0, 0xf9, 0xa5, 0x01, 0x29, 0x10, 0x18, 0xf0, 0x01, 0x38,
-  0x66, 0x76, 0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0xca, 0xd0, 0xe6, 0xa5,
-  0x76, 0x60
+  0x79, 0x0a, 0x85, 0x77, 0x20, 0x79, 0x0a, 0x85, 0x78, 0xd0, 0x04, 0xa5,
+  0x77, 0xf0, 0x41, 0xa5, 0x78, 0xc9, 0xff, 0xd0, 0x18, 0x20, 0x79, 0x0a,
+  0x85, 0x78, 0x20, 0x79, 0x0a, 0x20, 0x79, 0x0a, 0x20, 0xd2, 0xff, 0xe6,
+  0x77, 0xa5, 0x77, 0xc5, 0x78, 0xd0, 0xf2, 0xf0, 0xd2, 0x20, 0x79, 0x0a,
+  0x85, 0x2d, 0x20, 0x79, 0x0a, 0x85, 0x2e, 0x20, 0x79, 0x0a, 0x81, 0x77,
+  0xe6, 0x77, 0xd0, 0x02, 0xe6, 0x78, 0xa5, 0x77, 0xc5, 0x2d, 0xd0, 0xef,
+  0xa5, 0x78, 0xc5, 0x2e, 0xd0, 0xe9, 0xf0, 0xaf, 0x58, 0x20, 0x59, 0xa6,
+  0x20, 0x33, 0xa5, 0xad, 0x13, 0x09, 0xc9, 0x3c, 0xd0, 0x0a, 0xa2, 0x05,
+  0xbd, 0x00, 0x02, 0x95, 0x2f, 0xca, 0x10, 0xf8, 0x4c, 0x74, 0xa4, 0xa5,
+  0x2d, 0x48, 0xa5, 0x2e, 0x48, 0xa9, 0x60, 0x8d, 0x24, 0x0a, 0x20, 0x61,
+  0x09, 0xa9, 0x20, 0x8d, 0x24, 0x0a, 0x68, 0x85, 0x2e, 0x68, 0x85, 0x2d,
+  0x60, 0x84, 0x76, 0xa0, 0x08, 0xa5, 0x01, 0x29, 0xf7, 0x46, 0x76, 0x90,
+  0x02, 0x09, 0x08, 0x85, 0x01, 0xa5, 0x01, 0x49, 0x20, 0x85, 0x01, 0xa9,
+  0x10, 0x2c, 0x0d, 0xdc, 0xf0, 0xfb, 0x88, 0xd0, 0xe4, 0x60, 0xa2, 0x08,
+  0xa9, 0x10, 0x2c, 0x0d, 0xdc, 0xf0, 0xfb, 0xa5, 0x01, 0x29, 0x10, 0xc9,
+  0x10, 0xa5, 0x01, 0x49, 0x08, 0x85, 0x01, 0x66, 0x76, 0xca, 0xd0, 0xe8,
+  0xa5, 0x76, 0x60
 };
 
 #endif //MT_PETLOAD_C64TOM
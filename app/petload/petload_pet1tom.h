@@ -10,50 +10,64 @@
 //
 // xxd -i pet1tom.prg > pet1tom.h
 
-static uint8_t const s_petload_pet1tom[513] = {
+static uint8_t const s_petload_pet1tom[681] = {
   0x01, 0x04, 0x22, 0x04, 0x9d, 0x1d, 0x9e, 0x31, 0x30, 0x36, 0x30, 0x3a,
   0x8f, 0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x32, 0x31, 0x2c, 0x20,
   0x52, 0x48, 0x49, 0x4e, 0x4f, 0x44, 0x45, 0x56, 0x45, 0x4c, 0x00, 0x00,
-  0x00, 0xa6, 0x86, 0xa4, 0x87, 0x38, 0x8a, 0xe9, 0x30, 0x8d, 0x28, 0x05,
-  0x8d, 0x3a, 0x05, 0x8d, 0x03, 0x05, 0x8d, 0x15, 0x05, 0x85, 0x86, 0x98,
-  0xe9, 0x01, 0x8d, 0x29, 0x05, 0x8d, 0x3b, 0x05, 0x8d, 0x04, 0x05, 0x8d,
-  0x16, 0x05, 0x85, 0x87, 0x38, 0x8a, 0xe9, 0x20, 0x8d, 0xc4, 0x04, 0x98,
-  0xe9, 0x01, 0x8d, 0xc8, 0x04, 0x38, 0x8a, 0xe9, 0x4d, 0x8d, 0x3d, 0x05,
-  0x8d, 0x47, 0x05, 0x8d, 0x4c, 0x05, 0x8d, 0x59, 0x05, 0x8d, 0x5e, 0x05,
-  0x8d, 0x64, 0x05, 0x98, 0xe9, 0x00, 0x8d, 0x3e, 0x05, 0x8d, 0x48, 0x05,
-  0x8d, 0x4d, 0x05, 0x8d, 0x5a, 0x05, 0x8d, 0x5f, 0x05, 0x8d, 0x65, 0x05,
-  0x38, 0x8a, 0xe9, 0x25, 0x8d, 0x79, 0x05, 0x8d, 0x7e, 0x05, 0x8d, 0x89,
-  0x05, 0x8d, 0x8e, 0x05, 0x8d, 0x93, 0x05, 0x98, 0xe9, 0x00, 0x8d, 0x7a,
-  0x05, 0x8d, 0x7f, 0x05, 0x8d, 0x8a, 0x05, 0x8d, 0x8f, 0x05, 0x8d, 0x94,
-  0x05, 0xa9, 0xe0, 0x85, 0xae, 0xa9, 0x04, 0x85, 0xaf, 0xa9, 0x00, 0x85,
-  0xa9, 0xa9, 0x06, 0x85, 0xaa, 0x86, 0xa7, 0x84, 0xa8, 0x20, 0xe1, 0xc2,
-  0xa9, 0x4c, 0x85, 0xc2, 0xa9, 0xe0, 0x85, 0xc3, 0xa9, 0x04, 0x85, 0xc4,
-  0x78, 0xa0, 0xff, 0xad, 0x40, 0xe8, 0x49, 0x08, 0x8d, 0x40, 0xe8, 0xa2,
-  0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf0, 0x58, 0x60, 0xe6, 0xc9, 0xd0,
+  0x00, 0xa6, 0x86, 0xa4, 0x87, 0x38, 0x8a, 0xe9, 0x93, 0x8d, 0x70, 0x05,
+  0x8d, 0x9a, 0x05, 0x8d, 0x4b, 0x05, 0x8d, 0x5d, 0x05, 0x8d, 0x31, 0x06,
+  0x85, 0x86, 0x98, 0xe9, 0x01, 0x8d, 0x71, 0x05, 0x8d, 0x9b, 0x05, 0x8d,
+  0x4c, 0x05, 0x8d, 0x5e, 0x05, 0x8d, 0x32, 0x06, 0x85, 0x87, 0x38, 0x8a,
+  0xe9, 0x80, 0x8d, 0x09, 0x05, 0x98, 0xe9, 0x01, 0x8d, 0x0d, 0x05, 0x38,
+  0x8a, 0xe9, 0x4b, 0x8d, 0x9d, 0x05, 0x8d, 0xa7, 0x05, 0x8d, 0xac, 0x05,
+  0x8d, 0xb9, 0x05, 0x8d, 0xbe, 0x05, 0x8d, 0xc4, 0x05, 0x98, 0xe9, 0x00,
+  0x8d, 0x9e, 0x05, 0x8d, 0xa8, 0x05, 0x8d, 0xad, 0x05, 0x8d, 0xba, 0x05,
+  0x8d, 0xbf, 0x05, 0x8d, 0xc5, 0x05, 0x38, 0x8a, 0xe9, 0x23, 0x8d, 0xd9,
+  0x05, 0x8d, 0xde, 0x05, 0x8d, 0x07, 0x06, 0x8d, 0x0c, 0x06, 0x8d, 0x11,
+  0x06, 0x8d, 0xef, 0x05, 0x8d, 0xf4, 0x05, 0x8d, 0xf7, 0x05, 0x98, 0xe9,
+  0x00, 0x8d, 0xda, 0x05, 0x8d, 0xdf, 0x05, 0x8d, 0x08, 0x06, 0x8d, 0x0d,
+  0x06, 0x8d, 0x12, 0x06, 0x8d, 0xf0, 0x05, 0x8d, 0xf5, 0x05, 0x8d, 0xf8,
+  0x05, 0x38, 0x8a, 0xe9, 0x65, 0x8d, 0x26, 0x05, 0x98, 0xe9, 0x00, 0x8d,
+  0x27, 0x05, 0x38, 0x8a, 0xe9, 0x41, 0x8d, 0x4f, 0x06, 0x98, 0xe9, 0x01,
+  0x8d, 0x50, 0x06, 0x38, 0x8a, 0xe9, 0x7e, 0x8d, 0x4c, 0x06, 0x8d, 0x54,
+  0x06, 0x98, 0xe9, 0x00, 0x8d, 0x4d, 0x06, 0x8d, 0x55, 0x06, 0xa9, 0x25,
+  0x85, 0xae, 0xa9, 0x05, 0x85, 0xaf, 0xa9, 0xa8, 0x85, 0xa9, 0xa9, 0x06,
+  0x85, 0xaa, 0x86, 0xa7, 0x84, 0xa8, 0x20, 0xe1, 0xc2, 0xa9, 0x4c, 0x85,
+  0xc2, 0xa9, 0x28, 0x85, 0xc3, 0xa9, 0x05, 0x85, 0xc4, 0x78, 0xa0, 0xff,
+  0xad, 0x40, 0xe8, 0x49, 0x08, 0x8d, 0x40, 0xe8, 0xa2, 0x2f, 0xca, 0xd0,
+  0xfd, 0x88, 0xd0, 0xf0, 0x58, 0x60, 0x4c, 0x43, 0x06, 0xe6, 0xc9, 0xd0,
   0x02, 0xe6, 0xca, 0x84, 0xc5, 0xa4, 0xca, 0xc0, 0x00, 0xd0, 0x2c, 0xa4,
   0xc9, 0xc0, 0x0a, 0xd0, 0x26, 0xa0, 0x00, 0xb1, 0xc9, 0xc9, 0x21, 0xd0,
-  0x1e, 0xe6, 0xc9, 0xb1, 0xc9, 0xf0, 0x0c, 0x99, 0xd0, 0x04, 0xc8, 0xc0,
+  0x1e, 0xe6, 0xc9, 0xb1, 0xc9, 0xf0, 0x0c, 0x99, 0x15, 0x05, 0xc8, 0xc0,
   0x10, 0xd0, 0xf4, 0xb1, 0xc9, 0xd0, 0x0c, 0xa9, 0x20, 0xc0, 0x10, 0xf0,
-  0x0b, 0x99, 0xd0, 0x04, 0xc8, 0xd0, 0xf6, 0xa4, 0xc5, 0x4c, 0xc8, 0x00,
-  0x78, 0xa9, 0x00, 0x85, 0xc6, 0x85, 0xc7, 0xaa, 0xad, 0xd0, 0x04, 0xc9,
+  0x0b, 0x99, 0x15, 0x05, 0xc8, 0xd0, 0xf6, 0xa4, 0xc5, 0x4c, 0xc8, 0x00,
+  0x78, 0xa9, 0x00, 0x85, 0xc6, 0x85, 0xc7, 0xaa, 0xad, 0x15, 0x05, 0xc9,
+  0x3e, 0xd0, 0x14, 0xa9, 0x7a, 0x85, 0xc6, 0xa2, 0x01, 0xb5, 0x7c, 0xb4,
+  0x86, 0x94, 0x7c, 0x95, 0x86, 0xca, 0x10, 0xf5, 0xe8, 0xf0, 0x0c, 0xc9,
   0x2b, 0xd0, 0x08, 0xa5, 0x7a, 0x85, 0xc6, 0xa5, 0x7b, 0x85, 0xc7, 0x2c,
-  0x10, 0xe8, 0xbc, 0xd0, 0x04, 0x20, 0xb3, 0x05, 0xe8, 0xe0, 0x10, 0xd0,
-  0xf5, 0xa4, 0xc6, 0x20, 0xb3, 0x05, 0xa4, 0xc7, 0x20, 0xb3, 0x05, 0xa5,
-  0xc6, 0xd0, 0x04, 0xa5, 0xc7, 0xf0, 0x22, 0xa4, 0x7c, 0x20, 0xb3, 0x05,
-  0xa4, 0x7d, 0x20, 0xb3, 0x05, 0xb1, 0xc6, 0xa8, 0x20, 0xb3, 0x05, 0xe6,
+  0x10, 0xe8, 0xbc, 0x15, 0x05, 0x20, 0x5d, 0x06, 0xe8, 0xe0, 0x10, 0xd0,
+  0xf5, 0xa4, 0xc6, 0x20, 0x5d, 0x06, 0xa4, 0xc7, 0x20, 0x5d, 0x06, 0xa5,
+  0xc6, 0xd0, 0x04, 0xa5, 0xc7, 0xf0, 0x22, 0xa4, 0x7c, 0x20, 0x5d, 0x06,
+  0xa4, 0x7d, 0x20, 0x5d, 0x06, 0xb1, 0xc6, 0xa8, 0x20, 0x5d, 0x06, 0xe6,
   0xc6, 0xd0, 0x02, 0xe6, 0xc7, 0xa5, 0xc6, 0xc5, 0x7c, 0xd0, 0xee, 0xa5,
-  0xc7, 0xc5, 0x7d, 0xd0, 0xe8, 0x20, 0xdb, 0x05, 0x85, 0xc6, 0x20, 0xdb,
-  0x05, 0x85, 0xc7, 0xd0, 0x04, 0xa5, 0xc6, 0xf0, 0x21, 0x20, 0xdb, 0x05,
-  0x85, 0x7c, 0x20, 0xdb, 0x05, 0x85, 0x7d, 0x20, 0xdb, 0x05, 0x81, 0xc6,
-  0xe6, 0xc6, 0xd0, 0x02, 0xe6, 0xc7, 0xa5, 0xc6, 0xc5, 0x7c, 0xd0, 0xef,
-  0xa5, 0xc7, 0xc5, 0x7d, 0xd0, 0xe9, 0x58, 0x20, 0x67, 0xc5, 0x20, 0x33,
-  0xc4, 0x4c, 0x8b, 0xc3, 0x84, 0xc5, 0xa0, 0x08, 0x46, 0xc5, 0xad, 0x40,
-  0xe8, 0x29, 0xf7, 0x90, 0x02, 0x09, 0x08, 0x8d, 0x40, 0xe8, 0xad, 0x13,
-  0xe8, 0x49, 0x08, 0x8d, 0x13, 0xe8, 0xad, 0x11, 0xe8, 0x29, 0x80, 0xf0,
-  0xf9, 0x2c, 0x10, 0xe8, 0x88, 0xd0, 0xdd, 0x60, 0xa2, 0x08, 0xad, 0x11,
-  0xe8, 0x29, 0x80, 0xf0, 0xf9, 0x2c, 0x10, 0xe8, 0xad, 0x10, 0xe8, 0x29,
-  0x10, 0x18, 0xf0, 0x01, 0x38, 0x66, 0xc5, 0xad, 0x40, 0xe8, 0x49, 0x08,
-  0x8d, 0x40, 0xe8, 0xca, 0xd0, 0xe0, 0xa5, 0xc5, 0x60
+  0xc7, 0xc5, 0x7d, 0xd0, 0xe8, 0x20, 0x85, 0x06, 0x85, 0xc6, 0x20, 0x85,
+  0x06, 0x85, 0xc7, 0xd0, 0x04, 0xa5, 0xc6, 0xf0, 0x41, 0xa5, 0xc7, 0xc9,
+  0xff, 0xd0, 0x18, 0x20, 0x85, 0x06, 0x85, 0xc7, 0x20, 0x85, 0x06, 0x20,
+  0x85, 0x06, 0x20, 0xd2, 0xff, 0xe6, 0xc6, 0xa5, 0xc6, 0xc5, 0xc7, 0xd0,
+  0xf2, 0xf0, 0xd2, 0x20, 0x85, 0x06, 0x85, 0x7c, 0x20, 0x85, 0x06, 0x85,
+  0x7d, 0x20, 0x85, 0x06, 0x81, 0xc6, 0xe6, 0xc6, 0xd0, 0x02, 0xe6, 0xc7,
+  0xa5, 0xc6, 0xc5, 0x7c, 0xd0, 0xef, 0xa5, 0xc7, 0xc5, 0x7d, 0xd0, 0xe9,
+  0xf0, 0xaf, 0x58, 0x20, 0x67, 0xc5, 0x20, 0x33, 0xc4, 0xad, 0x15, 0x05,
+  0xc9, 0x3c, 0xd0, 0x09, 0xa2, 0x05, 0xb5, 0x0a, 0x95, 0x7e, 0xca, 0x10,
+  0xf9, 0x4c, 0x8b, 0xc3, 0xa5, 0x7c, 0x48, 0xa5, 0x7d, 0x48, 0xa9, 0x60,
+  0x8d, 0x2a, 0x06, 0x20, 0x67, 0x05, 0xa9, 0x20, 0x8d, 0x2a, 0x06, 0x68,
+  0x85, 0x7d, 0x68, 0x85, 0x7c, 0x60, 0x84, 0xc5, 0xa0, 0x08, 0xad, 0x40,
+  0xe8, 0x29, 0xf7, 0x46, 0xc5, 0x90, 0x02, 0x09, 0x08, 0x8d, 0x40, 0xe8,
+  0xad, 0x13, 0xe8, 0x49, 0x08, 0x8d, 0x13, 0xe8, 0xa9, 0x80, 0x2c, 0x11,
+  0xe8, 0xf0, 0xfb, 0x2c, 0x10, 0xe8, 0x88, 0xd0, 0xdd, 0x60, 0xa2, 0x08,
+  0xa9, 0x80, 0x2c, 0x11, 0xe8, 0xf0, 0xfb, 0x2c, 0x10, 0xe8, 0xad, 0x10,
+  0xe8, 0x29, 0x10, 0xc9, 0x10, 0xad, 0x40, 0xe8, 0x49, 0x08, 0x8d, 0x40,
+  0xe8, 0x66, 0xc5, 0xca, 0xd0, 0xe2, 0xa5, 0xc5, 0x60
 };
 
 #endif //MT_PETLOAD_PET1TOM
@@ -0,0 +1,26 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_PETLOAD_PET2BOOT
+#define MT_PETLOAD_PET2BOOT
+
+#include <stdint.h>
+
+// How to get byte array from (PRG) file:
+//
+// xxd -i pet2boot.prg > pet2boot.h
+
+static uint8_t const s_petload_pet2boot[114] = {
+  0x8f, 0x02, 0x78, 0xa0, 0xff, 0xad, 0x40, 0xe8, 0x49, 0x08, 0x8d, 0x40,
+  0xe8, 0xa2, 0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf0, 0x2c, 0x10, 0xe8,
+  0x20, 0xdc, 0x02, 0x85, 0x74, 0x20, 0xdc, 0x02, 0x85, 0x75, 0x20, 0xdc,
+  0x02, 0x85, 0x2a, 0x20, 0xdc, 0x02, 0x85, 0x2b, 0x20, 0xdc, 0x02, 0x81,
+  0x74, 0xe6, 0x74, 0xd0, 0x02, 0xe6, 0x75, 0xa5, 0x74, 0xc5, 0x2a, 0xd0,
+  0xef, 0xa5, 0x75, 0xc5, 0x2b, 0xd0, 0xe9, 0x20, 0x24, 0x04, 0x20, 0x72,
+  0xc5, 0x20, 0x42, 0xc4, 0x4c, 0x89, 0xc3, 0xa2, 0x08, 0xa9, 0x80, 0x2c,
+  0x11, 0xe8, 0xf0, 0xfb, 0x2c, 0x10, 0xe8, 0xad, 0x10, 0xe8, 0x29, 0x10,
+  0xc9, 0x10, 0xad, 0x40, 0xe8, 0x49, 0x08, 0x8d, 0x40, 0xe8, 0x66, 0x73,
+  0xca, 0xd0, 0xe2, 0xa5, 0x73, 0x60
+};
+
+#endif //MT_PETLOAD_PET2BOOT
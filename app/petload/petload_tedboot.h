@@ -0,0 +1,28 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_PETLOAD_TEDBOOT
+#define MT_PETLOAD_TEDBOOT
+
+#include <stdint.h>
+
+// How to get byte array from (PRG) file:
+//
+// xxd -i tedboot.prg > tedboot.h
+
+static uint8_t const s_petload_tedboot[134] = {
+  0x48, 0x03, 0x78, 0xa0, 0xff, 0xa5, 0x01, 0x49, 0x02, 0x85, 0x01, 0xa2,
+  0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf2, 0xa5, 0x01, 0x29, 0x10, 0x8d,
+  0x77, 0x04, 0x20, 0xa7, 0x03, 0x85, 0x22, 0x20, 0xa7, 0x03, 0x85, 0x23,
+  0x20, 0xa7, 0x03, 0x85, 0x2d, 0x20, 0xa7, 0x03, 0x85, 0x2e, 0x20, 0xa7,
+  0x03, 0x81, 0x22, 0xe6, 0x22, 0xd0, 0x02, 0xe6, 0x23, 0xa5, 0x22, 0xc5,
+  0x2d, 0xd0, 0xef, 0xa5, 0x23, 0xc5, 0x2e, 0xd0, 0xe9, 0x20, 0x24, 0x10,
+  0xa2, 0x04, 0xbd, 0xa2, 0x03, 0x9d, 0x00, 0x02, 0xca, 0x10, 0xf7, 0xa9,
+  0x00, 0x85, 0x3b, 0xa9, 0x02, 0x85, 0x3c, 0x60, 0x3a, 0x9c, 0x00, 0x00,
+  0x00, 0xa2, 0x08, 0xa5, 0x01, 0x29, 0x10, 0xcd, 0x77, 0x04, 0xf0, 0xf7,
+  0x8d, 0x77, 0x04, 0xad, 0x10, 0xfd, 0x29, 0x04, 0xc9, 0x04, 0xa5, 0x01,
+  0x49, 0x02, 0x85, 0x01, 0x6e, 0x76, 0x04, 0xca, 0xd0, 0xe1, 0xad, 0x76,
+  0x04, 0x60
+};
+
+#endif //MT_PETLOAD_TEDBOOT
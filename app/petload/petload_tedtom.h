@@ -0,0 +1,83 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_PETLOAD_TEDTOM
+#define MT_PETLOAD_TEDTOM
+
+#include <stdint.h>
+
+// How to get byte array from (PRG) file:
+//
+// xxd -i tedtom.prg > tedtom.h
+
+static uint8_t const s_petload_tedtom[800] = {
+  0x01, 0x10, 0x22, 0x10, 0x9d, 0x1d, 0x9e, 0x34, 0x31, 0x33, 0x32, 0x3a,
+  0x8f, 0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x32, 0x31, 0x2c, 0x20,
+  0x52, 0x48, 0x49, 0x4e, 0x4f, 0x44, 0x45, 0x56, 0x45, 0x4c, 0x00, 0x00,
+  0x00, 0xa6, 0x37, 0xa4, 0x38, 0xc0, 0x80, 0x90, 0x04, 0xa2, 0x00, 0xa0,
+  0x80, 0x38, 0x8a, 0xe9, 0xd8, 0x8d, 0xa0, 0x11, 0x8d, 0xce, 0x11, 0x8d,
+  0x7a, 0x11, 0x8d, 0x8c, 0x11, 0x8d, 0x62, 0x12, 0x85, 0x37, 0x98, 0xe9,
+  0x01, 0x8d, 0xa1, 0x11, 0x8d, 0xcf, 0x11, 0x8d, 0x7b, 0x11, 0x8d, 0x8d,
+  0x11, 0x8d, 0x63, 0x12, 0x85, 0x38, 0x38, 0x8a, 0xe9, 0xc5, 0x8d, 0x3b,
+  0x11, 0x98, 0xe9, 0x01, 0x8d, 0x40, 0x11, 0x38, 0x8a, 0xe9, 0x4d, 0x8d,
+  0xd1, 0x11, 0x8d, 0xdb, 0x11, 0x8d, 0xe0, 0x11, 0x8d, 0xed, 0x11, 0x8d,
+  0xf2, 0x11, 0x8d, 0xf8, 0x11, 0x98, 0xe9, 0x00, 0x8d, 0xd2, 0x11, 0x8d,
+  0xdc, 0x11, 0x8d, 0xe1, 0x11, 0x8d, 0xee, 0x11, 0x8d, 0xf3, 0x11, 0x8d,
+  0xf9, 0x11, 0x38, 0x8a, 0xe9, 0x25, 0x8d, 0x0d, 0x12, 0x8d, 0x12, 0x12,
+  0x8d, 0x3b, 0x12, 0x8d, 0x40, 0x12, 0x8d, 0x45, 0x12, 0x8d, 0x23, 0x12,
+  0x8d, 0x28, 0x12, 0x8d, 0x2b, 0x12, 0x98, 0xe9, 0x00, 0x8d, 0x0e, 0x12,
+  0x8d, 0x13, 0x12, 0x8d, 0x3c, 0x12, 0x8d, 0x41, 0x12, 0x8d, 0x46, 0x12,
+  0x8d, 0x24, 0x12, 0x8d, 0x29, 0x12, 0x8d, 0x2c, 0x12, 0x38, 0x8a, 0xe9,
+  0x94, 0x8d, 0x58, 0x11, 0x98, 0xe9, 0x00, 0x8d, 0x59, 0x11, 0x38, 0x8a,
+  0xe9, 0x88, 0x8d, 0x97, 0x12, 0x98, 0xe9, 0x01, 0x8d, 0x98, 0x12, 0x38,
+  0x8a, 0xe9, 0xc1, 0x8d, 0x94, 0x12, 0x8d, 0x9c, 0x12, 0x98, 0xe9, 0x00,
+  0x8d, 0x95, 0x12, 0x8d, 0x9d, 0x12, 0x38, 0x8a, 0xe9, 0x7a, 0x8d, 0x5f,
+  0x12, 0x98, 0xe9, 0x00, 0x8d, 0x60, 0x12, 0xa9, 0x57, 0x85, 0x26, 0xa9,
+  0x11, 0x85, 0x27, 0x18, 0xa5, 0x37, 0x69, 0x10, 0x85, 0x24, 0xa5, 0x38,
+  0x69, 0x00, 0x85, 0x25, 0xa0, 0x00, 0xb1, 0x26, 0x91, 0x24, 0xe6, 0x26,
+  0xd0, 0x02, 0xe6, 0x27, 0xe6, 0x24, 0xd0, 0x02, 0xe6, 0x25, 0xa5, 0x26,
+  0xc9, 0x1f, 0xd0, 0xea, 0xa5, 0x27, 0xc9, 0x13, 0xd0, 0xe4, 0xa9, 0x4c,
+  0x8d, 0x73, 0x04, 0xa9, 0x5a, 0x8d, 0x74, 0x04, 0xa9, 0x11, 0x8d, 0x75,
+  0x04, 0x78, 0xa0, 0xff, 0xa5, 0x01, 0x49, 0x02, 0x85, 0x01, 0xa2, 0x2f,
+  0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf2, 0x58, 0x60, 0x4c, 0x8b, 0x12, 0xe6,
+  0x3b, 0xd0, 0x02, 0xe6, 0x3c, 0x8c, 0x76, 0x04, 0xa4, 0x3c, 0xc0, 0x02,
+  0xd0, 0x28, 0xa4, 0x3b, 0xd0, 0x24, 0xb1, 0x3b, 0xc9, 0x21, 0xd0, 0x1e,
+  0xe6, 0x3b, 0xb1, 0x3b, 0xf0, 0x0c, 0x99, 0x47, 0x11, 0xc8, 0xc0, 0x10,
+  0xd0, 0xf4, 0xb1, 0x3b, 0xd0, 0x0c, 0xa9, 0x20, 0xc0, 0x10, 0xf0, 0x0c,
+  0x99, 0x47, 0x11, 0xc8, 0xd0, 0xf6, 0xac, 0x76, 0x04, 0x4c, 0x79, 0x04,
+  0x78, 0xa9, 0x00, 0x85, 0x22, 0x85, 0x23, 0xaa, 0xad, 0x47, 0x11, 0xc9,
+  0x3e, 0xd0, 0x14, 0xa9, 0x2b, 0x85, 0x22, 0xa2, 0x01, 0xb5, 0x2d, 0xb4,
+  0x37, 0x94, 0x2d, 0x95, 0x37, 0xca, 0x10, 0xf5, 0xe8, 0xf0, 0x0c, 0xc9,
+  0x2b, 0xd0, 0x08, 0xa5, 0x2b, 0x85, 0x22, 0xa5, 0x2c, 0x85, 0x23, 0xa5,
+  0x01, 0x29, 0x10, 0x8d, 0x77, 0x04, 0xbc, 0x47, 0x11, 0x20, 0xd2, 0x12,
+  0xe8, 0xe0, 0x10, 0xd0, 0xf5, 0xa4, 0x22, 0x20, 0xd2, 0x12, 0xa4, 0x23,
+  0x20, 0xd2, 0x12, 0xa5, 0x22, 0xd0, 0x04, 0xa5, 0x23, 0xf0, 0x22, 0xa4,
+  0x2d, 0x20, 0xd2, 0x12, 0xa4, 0x2e, 0x20, 0xd2, 0x12, 0xb1, 0x22, 0xa8,
+  0x20, 0xd2, 0x12, 0xe6, 0x22, 0xd0, 0x02, 0xe6, 0x23, 0xa5, 0x22, 0xc5,
+  0x2d, 0xd0, 0xee, 0xa5, 0x23, 0xc5, 0x2e, 0xd0, 0xe8, 0x20, 0xfa, 0x12,
+  0x85, 0x22, 0x20, 0xfa, 0x12, 0x85, 0x23, 0xd0, 0x04, 0xa5, 0x22, 0xf0,
+  0x41, 0xa5, 0x23, 0xc9, 0xff, 0xd0, 0x18, 0x20, 0xfa, 0x12, 0x85, 0x23,
+  0x20, 0xfa, 0x12, 0x20, 0xfa, 0x12, 0x20, 0xd2, 0xff, 0xe6, 0x22, 0xa5,
+  0x22, 0xc5, 0x23, 0xd0, 0xf2, 0xf0, 0xd2, 0x20, 0xfa, 0x12, 0x85, 0x2d,
+  0x20, 0xfa, 0x12, 0x85, 0x2e, 0x20, 0xfa, 0x12, 0x81, 0x22, 0xe6, 0x22,
+  0xd0, 0x02, 0xe6, 0x23, 0xa5, 0x22, 0xc5, 0x2d, 0xd0, 0xef, 0xa5, 0x23,
+  0xc5, 0x2e, 0xd0, 0xe9, 0xf0, 0xaf, 0x58, 0x20, 0xa5, 0x12, 0xad, 0x47,
+  0x11, 0xc9, 0x3c, 0xd0, 0x0e, 0xa2, 0x05, 0xbd, 0x00, 0x02, 0x95, 0x2f,
+  0xca, 0x10, 0xf8, 0xa9, 0x3a, 0xd0, 0x02, 0xa9, 0x9c, 0x8d, 0x00, 0x02,
+  0xa9, 0x00, 0x8d, 0x01, 0x02, 0xa9, 0x00, 0x85, 0x3b, 0xa9, 0x02, 0x85,
+  0x3c, 0x4c, 0x79, 0x04, 0xa5, 0x2d, 0x48, 0xa5, 0x2e, 0x48, 0xa9, 0x60,
+  0x8d, 0x5e, 0x12, 0x20, 0x97, 0x11, 0xa9, 0x20, 0x8d, 0x5e, 0x12, 0x68,
+  0x85, 0x2e, 0x68, 0x85, 0x2d, 0x60, 0xa5, 0x2b, 0x85, 0x22, 0xa5, 0x2c,
+  0x85, 0x23, 0xa0, 0x01, 0xb1, 0x22, 0xf0, 0x1e, 0xa0, 0x04, 0xc8, 0xb1,
+  0x22, 0xd0, 0xfb, 0xc8, 0x98, 0x18, 0x65, 0x22, 0xa0, 0x00, 0x91, 0x22,
+  0xaa, 0xa5, 0x23, 0x69, 0x00, 0xc8, 0x91, 0x22, 0x86, 0x22, 0x85, 0x23,
+  0xd0, 0xdc, 0x60, 0x8c, 0x76, 0x04, 0xa0, 0x08, 0xa5, 0x01, 0x29, 0xfd,
+  0x4e, 0x76, 0x04, 0x90, 0x02, 0x09, 0x02, 0x85, 0x01, 0xa5, 0x01, 0x49,
+  0x08, 0x85, 0x01, 0xa5, 0x01, 0x29, 0x10, 0xcd, 0x77, 0x04, 0xf0, 0xf7,
+  0x8d, 0x77, 0x04, 0x88, 0xd0, 0xde, 0x60, 0xa2, 0x08, 0xa5, 0x01, 0x29,
+  0x10, 0xcd, 0x77, 0x04, 0xf0, 0xf7, 0x8d, 0x77, 0x04, 0xad, 0x10, 0xfd,
+  0x29, 0x04, 0xc9, 0x04, 0xa5, 0x01, 0x49, 0x02, 0x85, 0x01, 0x6e, 0x76,
+  0x04, 0xca, 0xd0, 0xe1, 0xad, 0x76, 0x04, 0x60
+};
+
+#endif //MT_PETLOAD_TEDTOM
@@ -0,0 +1,26 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_PETLOAD_VIC20BOOT
+#define MT_PETLOAD_VIC20BOOT
+
+#include <stdint.h>
+
+// How to get byte array from (PRG) file:
+//
+// xxd -i vic20boot.prg > vic20boot.h
+
+static uint8_t const s_petload_vic20boot[114] = {
+  0x51, 0x03, 0x78, 0xa0, 0xff, 0xad, 0x20, 0x91, 0x49, 0x08, 0x8d, 0x20,
+  0x91, 0xa2, 0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf0, 0x2c, 0x21, 0x91,
+  0x20, 0x9e, 0x03, 0x85, 0x77, 0x20, 0x9e, 0x03, 0x85, 0x78, 0x20, 0x9e,
+  0x03, 0x85, 0x2d, 0x20, 0x9e, 0x03, 0x85, 0x2e, 0x20, 0x9e, 0x03, 0x81,
+  0x77, 0xe6, 0x77, 0xd0, 0x02, 0xe6, 0x78, 0xa5, 0x77, 0xc5, 0x2d, 0xd0,
+  0xef, 0xa5, 0x78, 0xc5, 0x2e, 0xd0, 0xe9, 0x20, 0x24, 0x10, 0x20, 0x59,
+  0xc6, 0x20, 0x33, 0xc5, 0x4c, 0x74, 0xc4, 0xa2, 0x08, 0xa9, 0x02, 0x2c,
+  0x2d, 0x91, 0xf0, 0xfb, 0x2c, 0x21, 0x91, 0xad, 0x11, 0x91, 0x29, 0x40,
+  0xc9, 0x40, 0xad, 0x20, 0x91, 0x49, 0x08, 0x8d, 0x20, 0x91, 0x66, 0x76,
+  0xca, 0xd0, 0xe2, 0xa5, 0x76, 0x60
+};
+
+#endif //MT_PETLOAD_VIC20BOOT
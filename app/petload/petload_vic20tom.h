@@ -10,50 +10,64 @@
 //
 // xxd -i vic20tom.prg > vic20tom.h
 
-static uint8_t const s_petload_vic20tom[509] = {
+static uint8_t const s_petload_vic20tom[678] = {
   0x01, 0x10, 0x22, 0x10, 0x9d, 0x1d, 0x9e, 0x34, 0x31, 0x33, 0x32, 0x3a,
   0x8f, 0x20, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x32, 0x31, 0x2c, 0x20,
   0x52, 0x48, 0x49, 0x4e, 0x4f, 0x44, 0x45, 0x56, 0x45, 0x4c, 0x00, 0x00,
-  0x00, 0xa6, 0x37, 0xa4, 0x38, 0x38, 0x8a, 0xe9, 0x2c, 0x8d, 0x24, 0x11,
-  0x8d, 0x36, 0x11, 0x8d, 0xff, 0x10, 0x8d, 0x11, 0x11, 0x85, 0x37, 0x98,
-  0xe9, 0x01, 0x8d, 0x25, 0x11, 0x8d, 0x37, 0x11, 0x8d, 0x00, 0x11, 0x8d,
-  0x12, 0x11, 0x85, 0x38, 0x38, 0x8a, 0xe9, 0x1c, 0x8d, 0xc4, 0x10, 0x98,
-  0xe9, 0x01, 0x8d, 0xc8, 0x10, 0x38, 0x8a, 0xe9, 0x4d, 0x8d, 0x39, 0x11,
-  0x8d, 0x43, 0x11, 0x8d, 0x48, 0x11, 0x8d, 0x55, 0x11, 0x8d, 0x5a, 0x11,
-  0x8d, 0x60, 0x11, 0x98, 0xe9, 0x00, 0x8d, 0x3a, 0x11, 0x8d, 0x44, 0x11,
-  0x8d, 0x49, 0x11, 0x8d, 0x56, 0x11, 0x8d, 0x5b, 0x11, 0x8d, 0x61, 0x11,
-  0x38, 0x8a, 0xe9, 0x25, 0x8d, 0x75, 0x11, 0x8d, 0x7a, 0x11, 0x8d, 0x85,
-  0x11, 0x8d, 0x8a, 0x11, 0x8d, 0x8f, 0x11, 0x98, 0xe9, 0x00, 0x8d, 0x76,
-  0x11, 0x8d, 0x7b, 0x11, 0x8d, 0x86, 0x11, 0x8d, 0x8b, 0x11, 0x8d, 0x90,
-  0x11, 0xa9, 0xe0, 0x85, 0x5f, 0xa9, 0x10, 0x85, 0x60, 0xa9, 0xfc, 0x85,
-  0x5a, 0xa9, 0x11, 0x85, 0x5b, 0x86, 0x58, 0x84, 0x59, 0x20, 0xbf, 0xc3,
-  0xa9, 0x4c, 0x85, 0x73, 0xa9, 0xe0, 0x85, 0x74, 0xa9, 0x10, 0x85, 0x75,
-  0x78, 0xa0, 0xff, 0xad, 0x20, 0x91, 0x49, 0x08, 0x8d, 0x20, 0x91, 0xa2,
-  0x2f, 0xca, 0xd0, 0xfd, 0x88, 0xd0, 0xf0, 0x58, 0x60, 0xe6, 0x7a, 0xd0,
+  0x00, 0xa6, 0x37, 0xa4, 0x38, 0x38, 0x8a, 0xe9, 0x90, 0x8d, 0x6c, 0x11,
+  0x8d, 0x96, 0x11, 0x8d, 0x47, 0x11, 0x8d, 0x59, 0x11, 0x8d, 0x2d, 0x12,
+  0x85, 0x37, 0x98, 0xe9, 0x01, 0x8d, 0x6d, 0x11, 0x8d, 0x97, 0x11, 0x8d,
+  0x48, 0x11, 0x8d, 0x5a, 0x11, 0x8d, 0x2e, 0x12, 0x85, 0x38, 0x38, 0x8a,
+  0xe9, 0x7d, 0x8d, 0x09, 0x11, 0x98, 0xe9, 0x01, 0x8d, 0x0d, 0x11, 0x38,
+  0x8a, 0xe9, 0x4b, 0x8d, 0x99, 0x11, 0x8d, 0xa3, 0x11, 0x8d, 0xa8, 0x11,
+  0x8d, 0xb5, 0x11, 0x8d, 0xba, 0x11, 0x8d, 0xc0, 0x11, 0x98, 0xe9, 0x00,
+  0x8d, 0x9a, 0x11, 0x8d, 0xa4, 0x11, 0x8d, 0xa9, 0x11, 0x8d, 0xb6, 0x11,
+  0x8d, 0xbb, 0x11, 0x8d, 0xc1, 0x11, 0x38, 0x8a, 0xe9, 0x23, 0x8d, 0xd5,
+  0x11, 0x8d, 0xda, 0x11, 0x8d, 0x03, 0x12, 0x8d, 0x08, 0x12, 0x8d, 0x0d,
+  0x12, 0x8d, 0xeb, 0x11, 0x8d, 0xf0, 0x11, 0x8d, 0xf3, 0x11, 0x98, 0xe9,
+  0x00, 0x8d, 0xd6, 0x11, 0x8d, 0xdb, 0x11, 0x8d, 0x04, 0x12, 0x8d, 0x09,
+  0x12, 0x8d, 0x0e, 0x12, 0x8d, 0xec, 0x11, 0x8d, 0xf1, 0x11, 0x8d, 0xf4,
+  0x11, 0x38, 0x8a, 0xe9, 0x65, 0x8d, 0x26, 0x11, 0x98, 0xe9, 0x00, 0x8d,
+  0x27, 0x11, 0x38, 0x8a, 0xe9, 0x42, 0x8d, 0x4c, 0x12, 0x98, 0xe9, 0x01,
+  0x8d, 0x4d, 0x12, 0x38, 0x8a, 0xe9, 0x7f, 0x8d, 0x49, 0x12, 0x8d, 0x51,
+  0x12, 0x98, 0xe9, 0x00, 0x8d, 0x4a, 0x12, 0x8d, 0x52, 0x12, 0xa9, 0x25,
+  0x85, 0x5f, 0xa9, 0x11, 0x85, 0x60, 0xa9, 0xa5, 0x85, 0x5a, 0xa9, 0x12,
+  0x85, 0x5b, 0x86, 0x58, 0x84, 0x59, 0x20, 0xbf, 0xc3, 0xa9, 0x4c, 0x85,
+  0x73, 0xa9, 0x28, 0x85, 0x74, 0xa9, 0x11, 0x85, 0x75, 0x78, 0xa0, 0xff,
+  0xad, 0x20, 0x91, 0x49, 0x08, 0x8d, 0x20, 0x91, 0xa2, 0x2f, 0xca, 0xd0,
+  0xfd, 0x88, 0xd0, 0xf0, 0x58, 0x60, 0x4c, 0x40, 0x12, 0xe6, 0x7a, 0xd0,
   0x02, 0xe6, 0x7b, 0x84, 0x76, 0xa4, 0x7b, 0xc0, 0x02, 0xd0, 0x28, 0xa4,
   0x7a, 0xd0, 0x24, 0xb1, 0x7a, 0xc9, 0x21, 0xd0, 0x1e, 0xe6, 0x7a, 0xb1,
-  0x7a, 0xf0, 0x0c, 0x99, 0xd0, 0x10, 0xc8, 0xc0, 0x10, 0xd0, 0xf4, 0xb1,
-  0x7a, 0xd0, 0x0c, 0xa9, 0x20, 0xc0, 0x10, 0xf0, 0x0b, 0x99, 0xd0, 0x10,
+  0x7a, 0xf0, 0x0c, 0x99, 0x15, 0x11, 0xc8, 0xc0, 0x10, 0xd0, 0xf4, 0xb1,
+  0x7a, 0xd0, 0x0c, 0xa9, 0x20, 0xc0, 0x10, 0xf0, 0x0b, 0x99, 0x15, 0x11,
   0xc8, 0xd0, 0xf6, 0xa4, 0x76, 0x4c, 0x79, 0x00, 0x78, 0xa9, 0x00, 0x85,
-  0x77, 0x85, 0x78, 0xaa, 0xad, 0xd0, 0x10, 0xc9, 0x2b, 0xd0, 0x08, 0xa5,
-  0x2b, 0x85, 0x77, 0xa5, 0x2c, 0x85, 0x78, 0x2c, 0x21, 0x91, 0xbc, 0xd0,
-  0x10, 0x20, 0xaf, 0x11, 0xe8, 0xe0, 0x10, 0xd0, 0xf5, 0xa4, 0x77, 0x20,
-  0xaf, 0x11, 0xa4, 0x78, 0x20, 0xaf, 0x11, 0xa5, 0x77, 0xd0, 0x04, 0xa5,
-  0x78, 0xf0, 0x22, 0xa4, 0x2d, 0x20, 0xaf, 0x11, 0xa4, 0x2e, 0x20, 0xaf,
-  0x11, 0xb1, 0x77, 0xa8, 0x20, 0xaf, 0x11, 0xe6, 0x77, 0xd0, 0x02, 0xe6,
+  0x77, 0x85, 0x78, 0xaa, 0xad, 0x15, 0x11, 0xc9, 0x3e, 0xd0, 0x14, 0xa9,
+  0x2b, 0x85, 0x77, 0xa2, 0x01, 0xb5, 0x2d, 0xb4, 0x37, 0x94, 0x2d, 0x95,
+  0x37, 0xca, 0x10, 0xf5, 0xe8, 0xf0, 0x0c, 0xc9, 0x2b, 0xd0, 0x08, 0xa5,
+  0x2b, 0x85, 0x77, 0xa5, 0x2c, 0x85, 0x78, 0x2c, 0x21, 0x91, 0xbc, 0x15,
+  0x11, 0x20, 0x5a, 0x12, 0xe8, 0xe0, 0x10, 0xd0, 0xf5, 0xa4, 0x77, 0x20,
+  0x5a, 0x12, 0xa4, 0x78, 0x20, 0x5a, 0x12, 0xa5, 0x77, 0xd0, 0x04, 0xa5,
+  0x78, 0xf0, 0x22, 0xa4, 0x2d, 0x20, 0x5a, 0x12, 0xa4, 0x2e, 0x20, 0x5a,
+  0x12, 0xb1, 0x77, 0xa8, 0x20, 0x5a, 0x12, 0xe6, 0x77, 0xd0, 0x02, 0xe6,
   0x78, 0xa5, 0x77, 0xc5, 0x2d, 0xd0, 0xee, 0xa5, 0x78, 0xc5, 0x2e, 0xd0,
-  0xe8, 0x20, 0xd7, 0x11, 0x85, 0x77, 0x20, 0xd7, 0x11, 0x85, 0x78, 0xd0,
-  0x04, 0xa5, 0x77, 0xf0, 0x21, 0x20, 0xd7, 0x11, 0x85, 0x2d, 0x20, 0xd7,
-  0x11, 0x85, 0x2e, 0x20, 0xd7, 0x11, 0x81, 0x77, 0xe6, 0x77, 0xd0, 0x02,
-  0xe6, 0x78, 0xa5, 0x77, 0xc5, 0x2d, 0xd0, 0xef, 0xa5, 0x78, 0xc5, 0x2e,
-  0xd0, 0xe9, 0x58, 0x20, 0x59, 0xc6, 0x20, 0x33, 0xc5, 0x4c, 0x74, 0xc4,
-  0x84, 0x76, 0xa0, 0x08, 0x46, 0x76, 0xad, 0x20, 0x91, 0x29, 0xf7, 0x90,
-  0x02, 0x09, 0x08, 0x8d, 0x20, 0x91, 0xad, 0x1c, 0x91, 0x49, 0x02, 0x8d,
-  0x1c, 0x91, 0xad, 0x2d, 0x91, 0x29, 0x02, 0xf0, 0xf9, 0x2c, 0x21, 0x91,
-  0x88, 0xd0, 0xdd, 0x60, 0xa2, 0x08, 0xad, 0x2d, 0x91, 0x29, 0x02, 0xf0,
-  0xf9, 0x2c, 0x21, 0x91, 0xad, 0x11, 0x91, 0x29, 0x40, 0x18, 0xf0, 0x01,
-  0x38, 0x66, 0x76, 0xad, 0x20, 0x91, 0x49, 0x08, 0x8d, 0x20, 0x91, 0xca,
-  0xd0, 0xe0, 0xa5, 0x76, 0x60
+  0xe8, 0x20, 0x82, 0x12, 0x85, 0x77, 0x20, 0x82, 0x12, 0x85, 0x78, 0xd0,
+  0x04, 0xa5, 0x77, 0xf0, 0x41, 0xa5, 0x78, 0xc9, 0xff, 0xd0, 0x18, 0x20,
+  0x82, 0x12, 0x85, 0x78, 0x20, 0x82, 0x12, 0x20, 0x82, 0x12, 0x20, 0xd2,
+  0xff, 0xe6, 0x77, 0xa5, 0x77, 0xc5, 0x78, 0xd0, 0xf2, 0xf0, 0xd2, 0x20,
+  0x82, 0x12, 0x85, 0x2d, 0x20, 0x82, 0x12, 0x85, 0x2e, 0x20, 0x82, 0x12,
+  0x81, 0x77, 0xe6, 0x77, 0xd0, 0x02, 0xe6, 0x78, 0xa5, 0x77, 0xc5, 0x2d,
+  0xd0, 0xef, 0xa5, 0x78, 0xc5, 0x2e, 0xd0, 0xe9, 0xf0, 0xaf, 0x58, 0x20,
+  0x59, 0xc6, 0x20, 0x33, 0xc5, 0xad, 0x15, 0x11, 0xc9, 0x3c, 0xd0, 0x0a,
+  0xa2, 0x05, 0xbd, 0x00, 0x02, 0x95, 0x2f, 0xca, 0x10, 0xf8, 0x4c, 0x74,
+  0xc4, 0xa5, 0x2d, 0x48, 0xa5, 0x2e, 0x48, 0xa9, 0x60, 0x8d, 0x26, 0x12,
+  0x20, 0x63, 0x11, 0xa9, 0x20, 0x8d, 0x26, 0x12, 0x68, 0x85, 0x2e, 0x68,
+  0x85, 0x2d, 0x60, 0x84, 0x76, 0xa0, 0x08, 0xad, 0x20, 0x91, 0x29, 0xf7,
+  0x46, 0x76, 0x90, 0x02, 0x09, 0x08, 0x8d, 0x20, 0x91, 0xad, 0x1c, 0x91,
+  0x49, 0x02, 0x8d, 0x1c, 0x91, 0xa9, 0x02, 0x2c, 0x2d, 0x91, 0xf0, 0xfb,
+  0x2c, 0x21, 0x91, 0x88, 0xd0, 0xdd, 0x60, 0xa2, 0x08, 0xa9, 0x02, 0x2c,
+  0x2d, 0x91, 0xf0, 0xfb, 0x2c, 0x21, 0x91, 0xad, 0x11, 0x91, 0x29, 0x40,
+  0xc9, 0x40, 0xad, 0x20, 0x91, 0x49, 0x08, 0x8d, 0x20, 0x91, 0x66, 0x76,
+  0xca, 0xd0, 0xe2, 0xa5, 0x76, 0x60
 };
 
 #endif //MT_PETLOAD_VIC20TOM
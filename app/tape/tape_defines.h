@@ -8,4 +8,12 @@
 //
 // HARD-CODED: This depends on tape_fill_buf()!
 
+#define MT_TAPE_CONTENT_BYTE_MICRO (2 * (592 + 9 * 432))
+//
+// Microseconds to send one byte of content data block (new-data marker, eight
+// data bits and parity bit, content data block is sent twice).
+//
+// HARD-CODED: This depends on tape_fill_buf() and on the pulse lengths used by
+//             tape_send_buf()!
+
 #endif  //MT_TAPE_DEFINES
@@ -8,12 +8,14 @@
 ; *********************
 
 bas_ver = 4 ; pet basic version to assemble for. can be set to 1, 2 or 4,
-            ; set to 20 for vic 20 assembly, 64 for c64 assembly.
+            ; set to 20 for vic 20 assembly, 64 for c64 assembly,
+            ; 16 for c16/plus/4 assembly, 128 for c128 assembly.
 
 tom_install = 0 ; 0 = install in tape buffers
                 ;     (which is possible for pet machines, only).
                 ; 1 = install to top of memory.
-                ; 2 = install at top of highest free memory (c64, only).
+                ; 2 = install at top of highest free memory (c64 and c128,
+                ;     only).
                 ;
                 ;     ALWAYS TO-DO FOR install at top of highest free memory:
                 ;     *******************************************************
@@ -23,6 +25,10 @@ tom_install = 0 ; 0 = install in tape buffers
                 ;     2) Uncomment Relocate (must be done, because assembler
                 ;        seems to ignore conditional assembly with Relocate..).
                 ;
+                ; 3 = first stage of two-stage bootstrap, to be stored in
+                ;     tape header (loads and runs the top-of-memory install
+                ;     prg assembled with option 1 or 2).
+                ;
                 ;     ALWAYS TO-DO FOR other install options:
                 ;     ***************************************
                 ;     1) Comment-out Relocate (see comment, above).
@@ -40,14 +46,20 @@ if tom_install = 1
 endif
 if tom_install = 2
     Incasm "03-topofree.asm"
-    ;Relocate $ced2;cpy_addr ; see ALWAYS TO-DO list, above!
+    ;Relocate $ce6e;cpy_addr ; see ALWAYS TO-DO list, above!
 endif
 
-Incasm "04-install.asm"
-Incasm "05-wedge.asm"
-Incasm "06-main.asm"
-Incasm "07-sendbyte.asm"
+if tom_install = 3
+    Incasm "03-boot.asm"
+else
+    Incasm "04-install.asm"
+    Incasm "05-wedge.asm"
+    Incasm "06-main.asm"
+    Incasm "07-sendbyte.asm"
+endif
 Incasm "08-readbyte.asm"
-Incasm "09-debug.asm"
+if tom_install <> 3
+    Incasm "09-debug.asm"
+endif
 
 Generateto cbmtapepi.prg
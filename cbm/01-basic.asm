@@ -24,6 +24,7 @@ bas_new     = $c553 ; new is at $c551, but this is without leading syntax check.
 bas_rstxclr = $c567
 bas_rechain = $c433
 bas_ready   = $c38b ; TODO: does not print anything ($c389, too).
+bas_rom_rout = 1 ; basic rom routines above are used.
 
 bas_indamask = %00010000 ; bit 4.
 bas_ackmask  = %00001000 ; bit 3.
@@ -73,6 +74,7 @@ bas_new     = $c55d ; new is at $c55b, but this is without leading syntax check.
 bas_rstxclr = $c572
 bas_rechain = $c442
 bas_ready   = $c389
+bas_rom_rout = 1 ; basic rom routines above are used.
 
 bas_indamask = %00010000 ; bit 4.
 bas_ackmask  = %00001000 ; bit 3.
@@ -122,6 +124,7 @@ bas_new     = $b5d4 ; new is at $b5d2, but this is without leading syntax check.
 bas_rstxclr = $b5e9
 bas_rechain = $b4b6
 bas_ready   = $b3ff
+bas_rom_rout = 1 ; basic rom routines above are used.
 
 bas_indamask = %00010000 ; bit 4.
 bas_ackmask  = %00001000 ; bit 3.
@@ -172,6 +175,7 @@ bas_new     = $c644 ; new is at $c642, but this is without leading syntax check.
 bas_rstxclr = $c659
 bas_rechain = $c533
 bas_ready   = $c474
+bas_rom_rout = 1 ; basic rom routines above are used.
 
 bas_indamask = %01000000 ; bit 6.
 bas_ackmask  = %00001000 ; bit 3.
@@ -216,6 +220,7 @@ bas_new     = $a644
 bas_rstxclr = $a659
 bas_rechain = $a533
 bas_ready   = $a474
+bas_rom_rout = 1 ; basic rom routines above are used.
 
 bas_indamask = %00010000 ; bit 4.
 bas_ackmask  = %00001000 ; bit 3.
@@ -237,3 +242,84 @@ bas_cas_wrt  = $01 ; bit 3. 6510.
 bas_cas_moto = $01 ; bit 5. 6510 (0 = motor on, 1 = motor off).
 
 endif
+
+if bas_ver = 16
+
+; c16 and plus/4 (ted).
+
+bas_buf     = $0200
+bas_sob     = $1001
+bas_sobptr  = $2b
+bas_sovptr  = $2d
+bas_tomptr  = $37 ; plus/4 default value: $fd00 (64768), see 03-topofmem.asm.
+bas_chrget  = $0473 ; not in zero-page.
+bas_chrgot  = $0479
+bas_txtptr  = $3b
+bas_addr    = $22 ; basic's index pointer, zero-page address for wedge's addr.
+bas_move_dst = $24 ; (own copy loop, see 03-topofmem.asm)
+bas_move_src = $26
+
+bas_rom_rout = 0 ; no basic rom routines used (own loops, instead).
+
+bas_indamask = %00000100 ; bit 2.
+bas_ackmask  = %00000010 ; bit 1.
+bas_oudmask  = %00000010 ; bit 1 = 1.
+bas_oudmaskn = %11111101 ; bit 1 = 0.
+
+bas_ordmask  = %00001000 ; bit 3.
+bas_ordmaskn = %11110111
+bas_inackmask = %00010000 ; bit 4.
+
+bas_cas_sens = $fd10 ; bit 2.
+
+bas_cas_read = $01 ; bit 4. 7501/8501, level only (there is no flag for a
+                   ; level change, see sendbyte() and readbyte()).
+bas_cas_read_reset = $01 ; (nothing to reset)
+
+bas_cas_wrt  = $01 ; bit 1. 7501/8501.
+
+bas_cas_moto = $01 ; bit 3. 7501/8501 (0 = motor on, 1 = motor off).
+
+endif
+
+if bas_ver = 128
+
+; c128 (native mode).
+
+bas_buf     = $0200
+bas_sob     = $1c01
+bas_sobptr  = $2d
+bas_sovptr  = $1210 ; end of basic program (variables are stored in bank 1).
+bas_tomptr  = $1212 ; top of basic program memory in bank 0.
+bas_chrget  = $0380 ; not in zero-page.
+bas_chrgot  = $0386
+bas_txtptr  = $3d
+bas_addr    = $fa ; free zero-page address for wedge's addr.
+bas_move_dst = $fc ; (own copy loop, see 03-topofree.asm)
+bas_move_src = $fa
+
+bas_rom_rout = 0 ; no basic rom routines used (own loops, instead).
+
+bas_bank0   = $ff01 ; storing any value selects bank 0 (ram only).
+bas_bank15  = $ff00 ; storing zero selects bank 15 (roms and i/o).
+
+bas_indamask = %00010000 ; bit 4.
+bas_ackmask  = %00001000 ; bit 3.
+bas_oudmask  = %00001000 ; bit 3 = 1.
+bas_oudmaskn = %11110111 ; bit 3 = 0.
+
+bas_ordmask  = %00100000 ; bit 5.
+bas_ordmaskn = %11011111
+bas_inackmask = %00010000 ; bit 4.
+
+bas_cas_sens = $01 ; bit 4. 8502.
+
+bas_cas_read = $dc0d ; bit 4 is high-to-low flag. cia 1, interrupt control reg.
+                     ; (56333).
+bas_cas_read_reset = $dc0d ; immediately clears on first read (see above)!
+
+bas_cas_wrt  = $01 ; bit 3. 8502.
+
+bas_cas_moto = $01 ; bit 5. 8502 (0 = motor on, 1 = motor off).
+
+endif
@@ -15,20 +15,30 @@ buf      = bas_buf      ; basic input buffer's address.
 sob      = bas_sob      ; start of basic program address.
 move_dst = bas_move_dst ; pointer to top of area to be moved to +1.
 move_src = bas_move_src ; pointer to top of area to be moved +1.
+if bas_rom_rout = 1
 move_bot = bas_move_bot ; pointer to bottom of area to be moved.
+endif
+if bas_ver = 128
+bank0    = bas_bank0    ; to access basic program and payload memory.
+bank15   = bas_bank15   ; to access roms and i/o.
+endif
 
 ; ----------------
 ; system functions
 ; ----------------
 
-memmove  = bas_memmove  ; move (copy?) memory.
 chrget   = bas_chrget
 chrgot   = bas_chrgot
+if bas_rom_rout = 1
+memmove  = bas_memmove  ; move (copy?) memory.
 new      = bas_new
 rstxclr  = bas_rstxclr  ; reset txtptr and perform basic clr command.
 rechain  = bas_rechain  ; rechain basic program in memory.
 ready    = bas_ready    ; print return, "ready.", return and waits for basic
                         ; line or direct command.
+endif
+chrout   = $ffd2        ; print character in register a (kernal jump table,
+                        ; same address for all supported machines).
 ; ----------
 ; peripheral
 ; ----------
@@ -48,6 +58,7 @@ cas_moto = bas_cas_moto
 sob_pet = 1025
 sob_vic = 4097
 sob_c64 = 2049
+sob_c128 = 7169
 
 ; for the basic loader to install at top of memory:
 ;
@@ -58,7 +69,7 @@ dec_addr2 = 0;(dec_addr / 100) MOD 10
 dec_addr3 = 6;(dec_addr / 10) MOD 10
 dec_addr4 = 0;dec_addr MOD 10
 endif
-if sob = sob_vic ; vic 20
+if sob = sob_vic ; vic 20 and c16/plus/4
 ;dec_addr = 4132;cpy_inst
 dec_addr1 = 4;dec_addr / 1000
 dec_addr2 = 1;(dec_addr / 100) MOD 10
@@ -72,13 +83,28 @@ dec_addr2 = 0;(dec_addr / 100) MOD 10
 dec_addr3 = 8;(dec_addr / 10) MOD 10
 dec_addr4 = 4;dec_addr MOD 10
 endif
+if sob = sob_c128 ; c128
+;dec_addr = 7204;cpy_inst
+dec_addr1 = 7;dec_addr / 1000
+dec_addr2 = 2;(dec_addr / 100) MOD 10
+dec_addr3 = 0;(dec_addr / 10) MOD 10
+dec_addr4 = 4;dec_addr MOD 10
+endif
 
 str_len  = 16           ; size of command string stored at label "str".
 
 cmd_char = $21          ; command symbol. $21 = "!".
 sav_char = "+"          ; to save a file (e.g. like "!+myfile.prg").
+snp_char = ">"          ; to save a ram snapshot (e.g. like "!>session"),
+                        ; top of memory installs, only.
+rst_char = "<"          ; to restore a ram snapshot (e.g. like "!<session"),
+                        ; top of memory installs, only.
 spc_char = $20          ; "empty" character to be used in string.
 zer_char = $30          ; zero character for basic loader. $30 = "0".
+prt_page = $ff          ; high byte of address marking payload to be printed
+                        ; instead of stored (top of memory installs, only).
+clr_tok  = $9c          ; basic clr token (for basic to execute at exit, if
+                        ; no basic rom routines are used).
 
 ; retrieve bytes:
 ;
@@ -101,6 +127,12 @@ inackmask = bas_inackmask ; cas_read
 ; use the three free bytes behind installed wedge jump:
 ;
 temp0    = chrget + 3
+if bas_rom_rout = 1
 addr     = chrget + 4 ; 2 bytes.
+else
+addr     = bas_addr   ; 2 bytes (chrget is not in zero-page on c16/plus/4
+                      ; and c128).
+lvl      = chrget + 4 ; level of read line last seen (c16/plus/4, only).
+endif
 
 ;lim      = <add address of some "unused" 2 byte long place in zero-page, here>
@@ -0,0 +1,102 @@
+
+; 2026.10.19
+;
+; marcel timm, rhinodevel
+
+; ************************************************
+; *** first stage of two-stage bootstrap       ***
+; *** (for top-of-memory installs, only)       ***
+; ************************************************
+
+; stored in the tape header's additional bytes (171 bytes available) and
+; started by a basic "sys" line that the pi sends as the tape file's content
+; (see petload.c). signals the pi the same way the installer does, retrieves
+; the complete top-of-memory fast mode prg via readbyte() and runs its
+; installer. this way only a few bytes go through the slow tape encoding.
+
+if sob = sob_pet
+* = $028f ; tape buffer #1 + 21 (see 03-tapebuf.asm).
+else
+if bas_ver = 16
+* = $0348 ; tape buffer + 21 (c16/plus/4).
+else
+if bas_ver = 128
+* = $0b15 ; tape buffer + 21 (c128).
+else
+* = $0351 ; tape buffer + 21 (vic 20 and c64).
+endif
+endif
+endif
+
+; address of the installer of the retrieved prg (same as for basic loader):
+;
+boot_inst = dec_addr1 * 1000 + dec_addr2 * 100 + dec_addr3 * 10 + dec_addr4
+
+boot     sei
+
+         ; toggle logic level all ~250us (see 04-install.asm):
+
+         ldy #$ff       ;   255 * ~252us = ~64ms for server to detect signal.
+
+bootlvl  lda cas_wrt    ;   4!
+         eor #ackmask   ;   2!
+         sta cas_wrt    ;   4!
+
+         ldx #47        ;   2!
+bootkeep dex            ;   2:
+         bne bootkeep   ; 3/2!
+
+         dey            ;   2!
+         bne bootlvl    ;   3!
+
+if bas_ver = 16
+         lda cas_read   ; remember current level of read line (there is no
+         and #inackmask ; flag to reset, see readbyte()).
+         sta lvl
+else
+         bit cas_read_reset ; makes sure that flag is not raised.
+endif
+
+         jsr readbyte   ; read address.
+         sta addr
+         jsr readbyte
+         sta addr + 1
+
+         jsr readbyte   ; read limit (first addr. above payload).
+         sta sovptr
+         jsr readbyte
+         sta sovptr + 1
+
+bootnext jsr readbyte   ; retrieve payload.
+         sta (addr,x)   ; [x is always 0 after readbyte()]
+         inc addr
+         bne bootchk
+         inc addr + 1
+bootchk  lda addr       ; check, if end is reached.
+         cmp sovptr
+         bne bootnext
+         lda addr + 1
+         cmp sovptr + 1
+         bne bootnext
+
+         jsr boot_inst  ; install wedge (sends signal again and does cli).
+
+if bas_rom_rout = 1
+         jsr rstxclr    ; equals preparations after basic load (see exit in
+         jsr rechain    ; 06-main.asm).
+
+         jmp ready
+else
+         ldx #4         ; let basic execute clr and end the program on return
+bootend  lda boottail,x ; from sys (no basic rom routines are used), the
+         sta buf,x      ; retrieved prg replaced the program running.
+         dex
+         bpl bootend
+         lda #<buf
+         sta txtptr
+         lda #>buf
+         sta txtptr + 1
+         rts
+
+boottail byte ":", clr_tok, 0, 0, 0 ; end of line and program follow clr.
+endif
@@ -34,11 +34,18 @@ bas_next word 0
 
           ldx tomptr                 ; store original top-of-memory address for
           ldy tomptr + 1             ; usage (because tom ptr. will be changed).
+if bas_ver = 16
+          cpy #$80                   ; plus/4: install below $8000, basic and
+          bcc tom_rdy                ; kernal roms are visible above.
+          ldx #0
+          ldy #$80
+tom_rdy
+endif
 
           ; correct addresses of str and update top-of-memory pointer:
           ;
-tom_str_offset = cpy_lim - wedge + str_len ; offset from str to byte following
-                                           ; the last byte.
+tom_str_offset = cpy_lim - prg_entry + str_len ; offset from str to byte
+                                                ; following the last byte.
           sec
           txa
           sbc #<tom_str_offset
@@ -46,6 +53,7 @@ tom_str_offset = cpy_lim - wedge + str_len ; offset from str to byte following
           sta strnext + 1
           sta str2 + 1
           sta str3 + 1
+          sta str4 + 1
           sta tomptr
           tya
           sbc #>tom_str_offset
@@ -53,6 +61,7 @@ tom_str_offset = cpy_lim - wedge + str_len ; offset from str to byte following
           sta strnext + 2
           sta str2 + 2
           sta str3 + 2
+          sta str4 + 2
           sta tomptr + 1
 
           ; correct address of wedge to jump to from chrget routine:
@@ -101,6 +110,9 @@ tom_read_offset = cpy_lim - readbyte ; offset from readbyte() to byte following
           sta read_lim + 1
           sta read2 + 1
           sta r_next + 1
+          sta read3 + 1
+          sta read4 + 1
+          sta read5 + 1
           tya
           sbc #>tom_read_offset
           sta retrieve + 2
@@ -108,14 +120,66 @@ tom_read_offset = cpy_lim - readbyte ; offset from readbyte() to byte following
           sta read_lim + 2
           sta read2 + 2
           sta r_next + 2
+          sta read3 + 2
+          sta read4 + 2
+          sta read5 + 2
+
+          ; correct addresses used by program entry [see prg_main()]:
+          ;
+tom_prg_offset = cpy_lim - prg_main  ; offset from prg_main() to byte following
+                                     ; the last byte.
+          sec
+          txa
+          sbc #<tom_prg_offset
+          sta prg_entry + 1
+          tya
+          sbc #>tom_prg_offset
+          sta prg_entry + 2
+          ;
+tom_main_offset = cpy_lim - main     ; offset from main to byte following the
+                                     ; last byte.
+          sec
+          txa
+          sbc #<tom_main_offset
+          sta prg_call + 1
+          tya
+          sbc #>tom_main_offset
+          sta prg_call + 2
+          ;
+tom_exit_offset = cpy_lim - exit - 1 ; offset from byte following exit's cli
+                                     ; to byte following the last byte.
+          sec
+          txa
+          sbc #<tom_exit_offset
+          sta prg_rts1 + 1
+          sta prg_rts2 + 1
+          tya
+          sbc #>tom_exit_offset
+          sta prg_rts1 + 2
+          sta prg_rts2 + 2
+
+if bas_rom_rout = 0
+          ; correct relink() address [called at exit, see 06-main.asm]:
+          ;
+tom_link_offset = cpy_lim - relink   ; offset from relink() to byte following
+                                     ; the last byte.
+          sec
+          txa
+          sbc #<tom_link_offset
+          sta exit + 2
+          tya
+          sbc #>tom_link_offset
+          sta exit + 3
+endif
 
           ; *** copy modified code to top of memory ***
 
+if bas_rom_rout = 1
           ; source bottom/start of area:
           ;
-          lda #<wedge
+          lda #<prg_entry
           sta move_bot
-          lda #>wedge
+          lda #>prg_entry
           sta move_bot + 1
  
           ; source top/end of area +1:
@@ -131,4 +195,37 @@ tom_read_offset = cpy_lim - readbyte ; offset from readbyte() to byte following
           sty move_dst + 1
 
           jsr memmove
+else
+          ; no memmove in basic rom to be used, copy forward (the areas do not
+          ; overlap):
+
+          lda #<prg_entry            ; source.
+          sta move_src
+          lda #>prg_entry
+          sta move_src + 1
+
+          clc                        ; destination (string buffer is located
+          lda tomptr                 ; at new top of memory).
+          adc #str_len
+          sta move_dst
+          lda tomptr + 1
+          adc #0
+          sta move_dst + 1
+
+          ldy #0
+cpy_next  lda (move_src),y
+          sta (move_dst),y
+          inc move_src
+          bne cpy_dst
+          inc move_src + 1
+cpy_dst   inc move_dst
+          bne cpy_chk
+          inc move_dst + 1
+cpy_chk   lda move_src
+          cmp #<cpy_lim
+          bne cpy_next
+          lda move_src + 1
+          cmp #>cpy_lim
+          bne cpy_next
+endif
 
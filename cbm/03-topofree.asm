@@ -3,7 +3,7 @@
 ;
 ; marcel timm, rhinodevel
 
-; c64, only.
+; c64 and c128, only.
 
 ; ********************************************************************
 ; *** basic "loader" (to support loading via <shift> + <runs/stop>)***
@@ -28,7 +28,12 @@ bas_next word 0
 ; *** install by copying to destination address ***
 ; *************************************************
 
+if bas_ver = 128
+topofree  = $1c00 ; top of free memory on c128 ($1300-$1bff, visible in bank 0
+                  ; and in bank 15).
+else
 topofree  = $d000 ; top of highest free memory on c64 ($c000-$cfff).
+endif
 cpy_bytes = cpy_lim - installer
 cpy_addr  = topofree - cpy_bytes
 cpy_src = jmptoinst + 3 ; to avoid unwanted relocation.
@@ -36,6 +41,7 @@ cpy_lim_to_use = cpy_src + cpy_bytes
 
           ; *** copy code to top of free memory ***
 
+if bas_rom_rout = 1
           ; source bottom/start of area:
           ;
           lda #<cpy_src
@@ -58,5 +64,35 @@ cpy_lim_to_use = cpy_src + cpy_bytes
           sta move_dst + 1
 
           jsr memmove
+else
+          ; no memmove in basic rom to be used, copy forward (the destination
+          ; is located below the source):
+
+          lda #<cpy_src              ; source.
+          sta move_src
+          lda #>cpy_src
+          sta move_src + 1
+
+          lda #<cpy_addr             ; destination.
+          sta move_dst
+          lda #>cpy_addr
+          sta move_dst + 1
+
+          ldy #0
+cpy_next  lda (move_src),y
+          sta (move_dst),y
+          inc move_src
+          bne cpy_dst
+          inc move_src + 1
+cpy_dst   inc move_dst
+          bne cpy_chk
+          inc move_dst + 1
+cpy_chk   lda move_src
+          cmp #<cpy_lim_to_use
+          bne cpy_next
+          lda move_src + 1
+          cmp #>cpy_lim_to_use
+          bne cpy_next
+endif
 
 jmptoinst jmp installer
@@ -13,7 +13,13 @@
 ; *** the wedge ***
 ; *****************
 
-; 16 bytes before the label "wedge" will be reused for cmd. string by wedge!
+; 16 bytes before the label "prg_entry" will be reused for cmd. string by
+; wedge!
+
+; entry for machine language programs [see prg_main() in 06-main.asm],
+; directly following the cmd. string buffer:
+;
+prg_entry jmp prg_main
 
 wedge    inc txtptr     ; increment here, because of code overwritten at chrget
          bne save_y     ; with jump to wedge.
@@ -22,7 +28,7 @@ wedge    inc txtptr     ; increment here, because of code overwritten at chrget
 ; relocation via assembler does not include str, if done this way
 ; (that is why the str label is not used):
 ;
-;str = wedge - str_len ; start of cmd. string buffer in use by wedge.
+;str = prg_entry - str_len ; start of cmd. string buffer in use by wedge.
 
 save_y   sty temp0      ; temporarily save original y register contents.
 
@@ -45,7 +51,7 @@ endif
          inc txtptr     ; save at most "str_len" count of characters from input.
 next_i   lda (txtptr),y ; copy from buffer to "str".
          beq fill_i
-str2     sta wedge - str_len,y
+str2     sta prg_entry - str_len,y
          iny
          cpy #str_len
          bne next_i
@@ -57,7 +63,7 @@ str2     sta wedge - str_len,y
 fill_i   lda #spc_char  ; fill remaining places in "str" array with spaces.
 next_f   cpy #str_len
          beq main
-str3     sta wedge - str_len,y
+str3     sta prg_entry - str_len,y
          iny
          bne next_f     ; always branches (saves one byte by not using jmp).
 
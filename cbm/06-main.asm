@@ -22,12 +22,35 @@ main     sei
          ;sta lim + 1
 
          lda #0
+if bas_ver = 128
+         sta bank15     ; select roms and i/o (by storing zero).
+endif
          sta addr
          sta addr + 1
          
          tax ; (for sending command string, below)
 
-str1     lda wedge - str_len
+str1     lda prg_entry - str_len
+if tom_install <> 0
+if bas_ver <> 128 ; (no snapshots for c128, basic variables are in bank 1)
+         cmp #snp_char  ; ram snapshot to save?
+         bne chk_sav
+
+         lda #sobptr    ; yes, send from (zero-page) start of basic pointer up
+         sta addr       ; to top of memory, by temporarily swapping top of
+         ldx #1         ; memory with start of variables pointer (the pi swaps
+snp_swap lda sovptr,x   ; them back).
+         ldy tomptr,x
+         sty sovptr,x
+         sta tomptr,x
+         dex
+         bpl snp_swap
+         inx            ; (x must be 0 for sending command string, below)
+         beq addrlim_rdy ; (always branches)
+
+chk_sav
+endif
+endif
          cmp #sav_char
          bne addrlim_rdy
 
@@ -41,12 +64,18 @@ addrlim_rdy
 
          ; motor signal must already be low or on its way to low, here.      
 
+if bas_ver = 16
+         lda cas_read   ; remember current level of read line (there is no
+         and #inackmask ; flag to reset, see sendbyte() and readbyte()).
+         sta lvl
+else
          bit cas_read_reset ; maybe not needed: makes sure that flag raised by
                             ;                   high-to-low on read line is not
                             ;                   raised (see pia documentation).
+endif
 
          ;ldx #0        ; send command string.
-strnext  ldy wedge - str_len,x
+strnext  ldy prg_entry - str_len,x
 
 send1    jsr sendbyte
          inx
@@ -69,7 +98,13 @@ send4    jsr sendbyte
 send5    jsr sendbyte
 
 s_next   ;ldy #0         ; (y is always 0 after sendbyte) ; send payload.
+if bas_ver = 128
+         sta bank0      ; (stored value does not matter)
          lda (addr),y
+         sty bank15     ; (y is 0)
+else
+         lda (addr),y
+endif
          tay
 send6    jsr sendbyte
          inc addr       ; increment to next (read) address.
@@ -101,10 +136,34 @@ read1    jsr readbyte
          ;
          ;lda addr + 1
          ;cmp #0        ; exit, if addr. is 0.
-         bne read_lim
+         bne read_prt
          lda addr
          beq exit      ; todo: overdone and maybe unwanted (see label)!
 
+read_prt
+if tom_install <> 0
+         lda addr + 1
+         cmp #prt_page
+         bne read_lim
+
+         ; print payload to screen instead of storing it (e.g. directory
+         ; listing), does not touch start of basic variables pointer. address
+         ; low byte is zero and limit low byte is the count of characters:
+
+read3    jsr readbyte   ; read limit low byte and use it as end marker for
+         sta addr + 1   ; address low byte.
+read4    jsr readbyte   ; (limit high byte is ignored)
+
+p_next
+read5    jsr readbyte
+         jsr chrout
+         inc addr
+         lda addr
+         cmp addr + 1
+         bne p_next
+         beq retrieve   ; (always branches)
+endif
+
 read_lim jsr readbyte  ; read payload "limit" (first addr. above payload).
          sta sovptr;lim
 read2    jsr readbyte
@@ -112,7 +171,13 @@ read2    jsr readbyte
 
 r_next   jsr readbyte   ; retrieve payload.
          ;ldx #0        ; [x is always 0 after readbyte()]
+if bas_ver = 128
+         sta bank0      ; (stored value does not matter)
+         sta (addr,x)   ; store byte at current address.
+         stx bank15     ; (x is 0)
+else
          sta (addr,x)   ; store byte at current address.
+endif
          inc addr       ; increment to next (write) address.
          bne r_finchk
          inc addr + 1
@@ -123,6 +188,9 @@ r_finchk lda addr       ; check, if end is reached.
          cmp sovptr + 1;lim + 1
          bne r_next
 
+         beq retrieve   ; (always branches) retrieve next payload, if any
+                        ; (the pi terminates a session with a zero address).
+
          ;;lda addr + 1
          ;sta sovptr + 1 ; set basic variables start pointer to behind loaded
          ;lda addr       ; payload.
@@ -130,7 +198,117 @@ r_finchk lda addr       ; check, if end is reached.
 
 exit     cli
 
+if bas_rom_rout = 1
          jsr rstxclr    ; equals preparations after basic load at
          jsr rechain    ; $c430/$c439/$b4ad/...
+else
+         jsr relink     ; (clr is done by basic, see below)
+endif
+
+if tom_install <> 0
+if bas_ver <> 128
+str4     lda prg_entry - str_len
+         cmp #rst_char  ; ram snapshot restored?
+         bne exit_rdy
 
+         ldx #5         ; yes, set pointers to arrays, end of arrays and bottom
+exit_cpy lda buf,x      ; of strings (reset by rstxclr, above) to the values
+         sta sobptr + 4,x ; the pi stored in input buffer.
+         dex
+         bpl exit_cpy
+if bas_rom_rout = 0
+         lda #":"       ; (nothing to execute, clr would reset pointers)
+         bne exit_bas   ; (always branches)
+endif
+exit_rdy
+endif
+endif
+if bas_rom_rout = 1
          jmp ready
+else
+         lda #clr_tok   ; let basic execute clr and print ready (via input
+exit_bas sta buf        ; buffer, returning like for characters not handled by
+         lda #0         ; the wedge).
+         sta buf + 1
+         lda #<buf
+         sta txtptr
+         lda #>buf
+         sta txtptr + 1
+         jmp chrgot
+endif
+
+; ***************************************************
+; *** main() for machine language programs        ***
+; ***************************************************
+
+; to be called via jsr (or sys) at prg_entry. the cmd. string must already be
+; stored in the 16 bytes before prg_entry (e.g. "#" to get next chunk of file
+; opened for channel usage).
+;
+; returns to caller and does not reset basic. start of basic variables
+; pointer gets restored (it is used as limit by main).
+
+prg_main lda sovptr
+         pha
+         lda sovptr + 1
+         pha
+
+         lda #$60       ; rts, makes exit return to prg_main.
+prg_rts1 sta exit + 1
+
+prg_call jsr main
+
+         lda #$20       ; jsr, restores exit for wedge usage.
+prg_rts2 sta exit + 1
+
+         pla
+         sta sovptr + 1
+         pla
+         sta sovptr
+         rts
+
+if bas_rom_rout = 0
+; ********************************************************
+; *** rechain basic program in memory.                 ***
+; ********************************************************
+; *** modifies registers a, x, y and memory at addr.   ***
+; ********************************************************
+
+; replaces basic rom's rechain routine (c16/plus/4 and c128), uses branches,
+; only (code gets relocated at runtime by top-of-memory installer).
+
+relink   lda sobptr
+         sta addr
+         lda sobptr + 1
+         sta addr + 1
+if bas_ver = 128
+         sta bank0      ; (stored value does not matter)
+endif
+link_nxt ldy #1
+         lda (addr),y   ; link's high byte is zero at end of program.
+         beq link_end
+         ldy #4         ; skip link and line number.
+link_eol iny            ; find zero terminating the line.
+         lda (addr),y
+         bne link_eol
+         iny            ; y is the offset of the next line, here.
+         tya
+         clc
+         adc addr
+         ldy #0
+         sta (addr),y   ; store link to next line (low byte).
+         tax
+         lda addr + 1
+         adc #0
+         iny
+         sta (addr),y   ; (high byte)
+         stx addr
+         sta addr + 1
+         bne link_nxt   ; (always branches)
+
+link_end
+if bas_ver = 128
+         sta bank15     ; (a is 0)
+endif
+         rts
+endif
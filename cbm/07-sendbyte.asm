@@ -11,37 +11,45 @@
 ; *** modifies registers a, y and memory at temp0.     ***
 ; ********************************************************
 
-sendbyte sty temp0      ; byte buffer during send.
-         ldy #8         ; (send bit) counter.
-
-sendloop lsr temp0      ; sends current bit to c flag.
-
-         lda cas_wrt    ; (does not change c flag)
-         and #oudmaskn  ; set bit to zero to send 0/low (does not change c fl.).
-         bcc senddata
-         ora #oudmask   ; set bit to one to send 1/high.
-senddata sta cas_wrt    ; set data bit.
-
-         lda cas_moto   ; motor signal toggle.
-         eor #ordmask   ;
-         sta cas_moto   ;
-
-sendwait lda cas_read
-         and #inackmask
-         beq sendwait
-         ;
-         ; this could be used alternatively for pet machines:
-         ;
-         ;bit cas_read   ; wait for data-ack. high-low (writes bit 7 to n flag).
-         ;bpl sendwait   ; branch, if n is 0 ("positive").
+; cycle counts per bit are given for a 1mhz cpu (pet), "!" means taken once,
+; ":" means taken in a loop (branch cycle count when branching / not).
+;
+; - the data-ack. flag is polled via bit with the mask in register a, which
+;   takes 7 cycles per poll instead of 9 (lda, and, beq).
+
+sendbyte sty temp0      ;   3! byte buffer during send.
+         ldy #8         ;   2! (send bit) counter.
+
+sendloop lda cas_wrt    ;   4! (does not change c flag)
+         and #oudmaskn  ;   2! set bit to zero to send 0/low.
+         lsr temp0      ;   5! sends current bit to c flag.
+         bcc senddata   ; 3/2!
+         ora #oudmask   ;   2! set bit to one to send 1/high.
+senddata sta cas_wrt    ;   4! set data bit.
+
+         lda cas_moto   ;   4! motor signal toggle.
+         eor #ordmask   ;   2!
+         sta cas_moto   ;   4!
+
+if bas_ver = 16
+sendwait lda cas_read   ;   4: wait for data-ack. level change (c16/plus/4
+         and #inackmask ;   2: have no flag for a change on the read line,
+         cmp lvl        ;   4: the pi toggles the level instead of sending
+         beq sendwait   ; 3/2: a pulse).
+         sta lvl        ;   4!
+else
+         lda #inackmask ;   2!
+sendwait bit cas_read   ;   4: wait for data-ack. high-low.
+         beq sendwait   ; 3/2:
+endif
 
 if cas_read <> cas_read_reset
-         bit cas_read_reset ; resets "toggle" bit by read operation (see docs,
-                            ; not necessary for cia of c64).
+         bit cas_read_reset ; 4! resets "toggle" bit by read operation (see
+                            ;    docs, not necessary for cia of c64).
 endif
 
-         dey
-         bne sendloop   ; last bit read?
+         dey            ;   2!
+         bne sendloop   ;   3! last bit read?
 
          rts            ; y is 0, here!
 
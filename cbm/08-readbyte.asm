@@ -11,36 +11,43 @@
 ; *** modifies registers a, x and memory at temp0.     ***
 ; ********************************************************
 
-readbyte ldx #8         ; (read bit) counter.
-
-readwait lda cas_read
-         and #inackmask
-         beq readwait
-         ;
-         ; this could be used alternatively for pet machines:
-         ;
-         ;bit cas_read   ; wait for data-ready toggling (writes bit 7 to n flag).
-         ;bpl readwait   ; branch, if n is 0 ("positive").
+; cycle counts per bit, see sendbyte():
+;
+; - the data bit is moved into the c flag without branching and the data-ack.
+;   is toggled before the bit gets stored, to let the pi continue as early as
+;   possible.
+
+readbyte ldx #8         ;   2! (read bit) counter.
+
+if bas_ver = 16
+readnext lda cas_read   ;   4: wait for data-ready level change (see
+         and #inackmask ;   2: sendbyte()).
+         cmp lvl        ;   4:
+         beq readnext   ; 3/2:
+         sta lvl        ;   4!
+else
+readnext lda #inackmask ;   2!
+readwait bit cas_read   ;   4: wait for data-ready toggling.
+         beq readwait   ; 3/2:
+endif
 
 if cas_read <> cas_read_reset
-         bit cas_read_reset ; resets "toggle" bit by read operation (see docs,
-                            ; not necessary for cia of c64).
+         bit cas_read_reset ; 4! resets "toggle" bit by read operation (see
+                            ;    docs, not necessary for cia of c64).
 endif
 
-         lda cas_sens   ; load actual data (bit 4) into c flag.
-         and #indamask  ; sets z flag to 1, if bit 4 is 0.
-         clc            ;
-         beq readadd    ; bit read is zero.
-         sec            ;
+         lda cas_sens   ;   4! load actual data bit.
+         and #indamask  ;   2!
+         cmp #indamask  ;   2! sets c flag to 1, if data bit is 1.
 
-readadd  ror temp0      ; put read bit from c flag into byte buffer.
+         lda cas_wrt    ;   4! acknowledge data bit ("toggle" data-req. line
+         eor #ackmask   ;   2! level), does not change c flag.
+         sta cas_wrt    ;   4!
 
-         lda cas_wrt    ; acknowledge data bit ("toggle" data-req. line level).
-         eor #ackmask   ; toggle output bit.
-         sta cas_wrt    ;
+         ror temp0      ;   5! put read bit from c flag into byte buffer.
 
-         dex
-         bne readwait   ; last bit read?
+         dex            ;   2!
+         bne readnext   ;   3! last bit read?
 
          lda temp0
          rts            ; read byte is in register a and in memory at temp0,
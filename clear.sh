@@ -31,11 +31,17 @@ rm lib/xmodem/xmodem.o
 rm lib/ymodem/ymodem.o
 rm lib/petasc/petasc.o
 rm lib/sort/sort.o
+rm lib/sectorcache/sectorcache.o
+rm lib/filecache/filecache.o
 rm lib/dir/dir.o
+rm lib/d64/d64.o
+rm lib/inflate/inflate.o
+rm lib/zip/zip.o
 rm lib/filesys/filesys.o
 rm lib/cfg/cfg.o
 rm lib/ff14/source/diskio.o
 rm lib/ff14/source/ff.o
+rm lib/ff14/source/ffunicode.o
 
 # Application-specific files:
 
@@ -60,6 +66,10 @@ rm app/ui/ui.o
 rm app/cbm/cbm_receive.o
 rm app/cbm/cbm_send.o
 rm app/cmd/cmd.o
+rm app/cmd/cmd_chan.o
+rm app/cmd/cmd_dir.o
+rm app/cmd/cmd_index.o
+rm app/cmd/cmd_snap.o
 rm app/petload/petload.o
 rm app/mode/mode.o
 
@@ -120,11 +120,17 @@ $MT_CC lib/xmodem/xmodem.c -o lib/xmodem/xmodem.o
 $MT_CC lib/ymodem/ymodem.c -o lib/ymodem/ymodem.o
 $MT_CC lib/petasc/petasc.c -o lib/petasc/petasc.o
 $MT_CC lib/sort/sort.c -o lib/sort/sort.o
+$MT_CC lib/sectorcache/sectorcache.c -o lib/sectorcache/sectorcache.o
+$MT_CC lib/filecache/filecache.c -o lib/filecache/filecache.o
 $MT_CC lib/dir/dir.c -o lib/dir/dir.o
+$MT_CC lib/d64/d64.c -o lib/d64/d64.o
+$MT_CC lib/inflate/inflate.c -o lib/inflate/inflate.o
+$MT_CC lib/zip/zip.c -o lib/zip/zip.o
 $MT_CC lib/filesys/filesys.c -o lib/filesys/filesys.o
 $MT_CC lib/cfg/cfg.c -o lib/cfg/cfg.o
 $MT_CC lib/ff14/source/diskio.c -o lib/ff14/source/diskio.o
 $MT_CC lib/ff14/source/ff.c -o lib/ff14/source/ff.o
+$MT_CC lib/ff14/source/ffunicode.c -o lib/ff14/source/ffunicode.o
 
 # Hardware-dependent drivers (may use library compiled above):
 #
@@ -161,6 +167,10 @@ $MT_CC app/ui/ui.c -o app/ui/ui.o
 $MT_CC app/cbm/cbm_receive.c -o app/cbm/cbm_receive.o
 $MT_CC app/cbm/cbm_send.c -o app/cbm/cbm_send.o
 $MT_CC app/cmd/cmd.c -o app/cmd/cmd.o
+$MT_CC app/cmd/cmd_chan.c -o app/cmd/cmd_chan.o
+$MT_CC app/cmd/cmd_dir.c -o app/cmd/cmd_dir.o
+$MT_CC app/cmd/cmd_index.c -o app/cmd/cmd_index.o
+$MT_CC app/cmd/cmd_snap.c -o app/cmd/cmd_snap.o
 $MT_CC app/petload/petload.c -o app/petload/petload.o
 $MT_CC app/mode/mode.c -o app/mode/mode.o
 $MT_CC app/kernel_main.c -o app/kernel_main.o
@@ -197,6 +207,10 @@ arm-none-eabi-gcc \
     app/cbm/cbm_receive.o \
     app/cbm/cbm_send.o \
     app/cmd/cmd.o \
+    app/cmd/cmd_chan.o \
+    app/cmd/cmd_dir.o \
+    app/cmd/cmd_index.o \
+    app/cmd/cmd_snap.o \
     app/petload/petload.o \
     app/mode/mode.o \
     \
@@ -213,11 +227,17 @@ arm-none-eabi-gcc \
     lib/ymodem/ymodem.o \
     lib/petasc/petasc.o \
     lib/sort/sort.o \
+    lib/sectorcache/sectorcache.o \
+    lib/filecache/filecache.o \
     lib/dir/dir.o \
+    lib/d64/d64.o \
+    lib/inflate/inflate.o \
+    lib/zip/zip.o \
     lib/filesys/filesys.o \
     lib/cfg/cfg.o \
     lib/ff14/source/diskio.o \
     lib/ff14/source/ff.o \
+    lib/ff14/source/ffunicode.o \
     \
     hardware/gpio/gpio.o \
     hardware/mailbox/mailbox.o \
@@ -68,7 +68,10 @@ void alloc_free(void * const block_addr)
     nodemem_limit_free_nodes();
 }
 
-void* alloc_alloc(MT_USIGN const wanted_len)
+/** Allocate block with at least given length, starting at an address being a
+ *  multiple of given alignment (a power of two, at least granularity).
+ */
+static void* alloc(MT_USIGN const wanted_len, MT_USIGN const alignment)
 {
     struct node * new_node_addr = 0,
         * node_addr = 0,
@@ -99,7 +102,10 @@ void* alloc_alloc(MT_USIGN const wanted_len)
         return 0; // No more space for another node available.
     }
 
-    node_addr = nodemem_get_alloc_node_addr(gran_wanted_len);
+    // Worst case is to skip alignment minus granularity bytes:
+    //
+    node_addr = nodemem_get_alloc_node_addr(
+        gran_wanted_len + alignment - MT_ALLOC_GRANULARITY);
     if(node_addr == 0)
     {
         assert(false);
@@ -108,19 +114,26 @@ void* alloc_alloc(MT_USIGN const wanted_len)
 
     assert(node_addr->is_allocated == 0);
 
-    if(node_addr->block_len == gran_wanted_len)
+    // Take block from end of node's block (padding at end belongs to new
+    // block):
+    //
+    uintptr_t const end = (uintptr_t)node_addr->block_addr
+            + node_addr->block_len,
+        beg = (end - gran_wanted_len) & ~(uintptr_t)(alignment - 1);
+    MT_USIGN const len = (MT_USIGN)(end - beg);
+
+    if(node_addr->block_len == len)
     {
         node_addr->is_allocated = 1;
 
         return node_addr->block_addr;
     }
 
-    new_node.block_len = gran_wanted_len;
+    new_node.block_len = len;
     new_node.is_allocated = 1;
     new_node.last_node_addr = node_addr;
     new_node.next_node_addr = node_addr->next_node_addr;
-    new_node.block_addr =
-        node_addr->block_addr + node_addr->block_len - gran_wanted_len;
+    new_node.block_addr = (void *)beg;
 
     new_node_addr = nodemem_store(&new_node);
     if(new_node_addr == 0)
@@ -144,6 +157,22 @@ void* alloc_alloc(MT_USIGN const wanted_len)
     return new_node.block_addr;
 }
 
+void* alloc_alloc(MT_USIGN const wanted_len)
+{
+    return alloc(wanted_len, MT_ALLOC_GRANULARITY);
+}
+
+void* alloc_alloc_aligned(MT_USIGN const wanted_len, MT_USIGN const alignment)
+{
+    if(alignment < MT_ALLOC_GRANULARITY
+        || (alignment & (alignment - 1)) != 0)
+    {
+        assert(false);
+        return 0; // Must be a power of two, at least granularity.
+    }
+    return alloc(wanted_len, alignment);
+}
+
 void alloc_init(void * const mem, MT_USIGN const mem_len)
 {
     nodemem_init(mem, mem_len);
@@ -12,6 +12,14 @@ void alloc_free(void * const block_addr);
 
 void* alloc_alloc(MT_USIGN const wanted_len);
 
+/** Same as alloc_alloc(), but returned block starts at an address being a
+ *  multiple of given alignment (e.g. 512 for SD card sectors).
+ *
+ * - Alignment must be a power of two and at least MT_ALLOC_GRANULARITY.
+ * - Free via alloc_free(), as usual.
+ */
+void* alloc_alloc_aligned(MT_USIGN const wanted_len, MT_USIGN const alignment);
+
 void alloc_init(void * const mem, MT_USIGN const mem_len);
 
 #endif //MT_ALLOC
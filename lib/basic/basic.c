@@ -17,6 +17,81 @@ static uint16_t const s_end_of_prg = 0x0000;
 static uint16_t const s_line_first = 1000;
 static uint16_t const s_line_step = 10;
 
+uint32_t basic_fill_prints(
+    uint8_t * const buf,
+    uint16_t const addr,
+    uint32_t const line_index,
+    char const * const * const str_arr,
+    uint32_t const str_count,
+    char const petscii_not_found_replacer)
+{
+    assert(buf != 0);
+    assert(addr > 0);
+    assert(str_arr != 0);
+    assert(str_count > 0);
+
+    uint32_t i = 0;
+    uint32_t const len_sum = str_get_len_sum(str_arr, str_count);
+    uint16_t const next_line_addr = addr
+        + (uint16_t)MT_BASIC_PRINTS_LEN(str_count, len_sum);
+    uint16_t const line_nr = s_line_first
+        + (uint16_t)line_index * s_line_step;
+
+    assert(
+        len_sum + 3 * (str_count - 1) <= MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE);
+
+    // *** Link to next line: ***
+
+    buf[i++] = (uint8_t)(next_line_addr & 0x00FF);
+    buf[i++] = (uint8_t)(next_line_addr >> 8);
+
+    // *** Line number: ***
+
+    buf[i++] = (uint8_t)(line_nr & 0x00FF);
+    buf[i++] = (uint8_t)(line_nr >> 8);
+
+    // *** Line content: ***
+
+    buf[i++] = (uint8_t)basic_token_print; // PRINT
+
+    for(uint32_t j = 0;j < str_count;++j)
+    {
+        if(j > 0)
+        {
+            buf[i++] = ','; // Next column.
+        }
+
+        buf[i++] = '"';
+        for(uint32_t k = 0;str_arr[j][k] != '\0';++k)
+        {
+            buf[i++] = petasc_get_petscii(
+                str_arr[j][k], petscii_not_found_replacer);
+        }
+        buf[i++] = '"';
+    }
+
+    // *** End of line: ***
+
+    buf[i++] = s_end_of_line;
+
+    assert(i == MT_BASIC_PRINTS_LEN(str_count, len_sum));
+
+    return i;
+}
+
+uint32_t basic_fill_print(
+    uint8_t * const buf,
+    uint16_t const addr,
+    uint32_t const line_index,
+    char const * const str,
+    char const petscii_not_found_replacer)
+{
+    assert(str != 0);
+
+    return basic_fill_prints(
+        buf, addr, line_index, &str, 1, petscii_not_found_replacer);
+}
+
 uint8_t* basic_get_prints(
     uint16_t const addr,
     char const * const * const str_arr,
@@ -30,7 +105,6 @@ uint8_t* basic_get_prints(
     assert(len != 0);
 
     uint32_t i = 0;
-    uint16_t line_nr = s_line_first;
 
     if(str_get_len_max(str_arr, str_count) > MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE)
     {
@@ -41,15 +115,7 @@ uint8_t* basic_get_prints(
     uint32_t const str_len_all = str_get_len_sum(str_arr, str_count);
 
     *len = 2 // Address
-        + ( // One line.
-            2 // Link to next line.
-            + 2 // Line number.
-            + 1 // BASIC token PRINT.
-            + 1 // "
-            // (actual string gets here)
-            + 1 // "
-            + 1 // End of line.
-        ) * str_count
+        + MT_BASIC_PRINT_LEN(0) * str_count // One line.
 
         + 2 // End of program.
 
@@ -64,46 +130,12 @@ uint8_t* basic_get_prints(
 
     for(uint32_t j = 0;j < str_count;++j)
     {
-        uint32_t const len_str = str_get_len(str_arr[j]);
-        uint16_t const next_line_addr = addr
-            + (uint16_t)i // Alr. written byte count.
-            + 2 // Link to next line.
-            + 2 // Line number.
-            + 1 // BASIC token PRINT.
-            + 1 // "
-            + len_str // Actual string.
-            + 1 // "
-            + 1; // End of line.
-
-        uint32_t k = 0;
-
-        // *** Link to next line: ***
-
-        ret_val[i++] = (uint8_t)(next_line_addr & 0x00FF);
-        ret_val[i++] = (uint8_t)(next_line_addr >> 8);
-
-        // *** Line number: ***
-
-        ret_val[i++] = (uint8_t)(line_nr & 0x00FF);
-        ret_val[i++] = (uint8_t)(line_nr >> 8);
-        line_nr += s_line_step;
-
-        // *** Line content: ***
-
-        ret_val[i++] = (uint8_t)basic_token_print; // PRINT
-
-        ret_val[i++] = '"';
-        while(str_arr[j][k] != '\0')
-        {
-            ret_val[i++] = petasc_get_petscii(
-                str_arr[j][k], petscii_not_found_replacer);
-            ++k;
-        }
-        ret_val[i++] = '"';
-
-        // *** End of line: ***
-
-        ret_val[i++] = s_end_of_line;
+        i += basic_fill_print(
+            ret_val + i,
+            addr + (uint16_t)i - 2, // (-2 for address bytes)
+            j,
+            str_arr[j],
+            petscii_not_found_replacer);
     }
 
     // *** End of program: ***
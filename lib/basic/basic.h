@@ -9,6 +9,18 @@
 
 #define MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE 80
 
+// Byte count of a BASIC line printing a string with given length (see
+// basic_fill_print()), link to next line, line number, PRINT token, quotes
+// and end of line included:
+//
+#define MT_BASIC_PRINT_LEN(str_len) (2 + 2 + 1 + 1 + (str_len) + 1 + 1)
+
+// Byte count of a BASIC line printing given count of strings (with given sum of
+// lengths) separated by commas (see basic_fill_prints()):
+//
+#define MT_BASIC_PRINTS_LEN(str_count, str_len_sum) \
+    (2 + 2 + 1 + (str_len_sum) + 3 * (str_count) - 1 + 1)
+
 /** Return BASIC PRG binary printing each string given in one line.
  *
  * - Fills given len with length of return value in byte.
@@ -23,6 +35,39 @@ uint8_t* basic_get_prints(
     char const petscii_not_found_replacer,
     uint32_t * const len);
 
+/** Fill given buffer with the BASIC line at given address and with given
+ *  (zero-based) index printing given string, to create BASIC PRG line by line
+ *  (see basic_get_prints()).
+ *
+ * - Given buffer must be able to hold MT_BASIC_PRINT_LEN(length of string).
+ * - Returns count of bytes written.
+ * - Given string must not be longer than MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE.
+ */
+uint32_t basic_fill_print(
+    uint8_t * const buf,
+    uint16_t const addr,
+    uint32_t const line_index,
+    char const * const str,
+    char const petscii_not_found_replacer);
+
+/** Fill given buffer with the BASIC line at given address and with given
+ *  (zero-based) index printing all given strings in one line, separated by
+ *  commas (making the CBM print each one in the next column).
+ *
+ * - Given buffer must be able to hold MT_BASIC_PRINTS_LEN(count of strings,
+ *   sum of string lengths).
+ * - Returns count of bytes written.
+ * - Sum of string lengths plus quotes and commas between strings must not be
+ *   larger than MT_BASIC_MAX_CHAR_PER_LOGICAL_LINE.
+ */
+uint32_t basic_fill_prints(
+    uint8_t * const buf,
+    uint16_t const addr,
+    uint32_t const line_index,
+    char const * const * const str_arr,
+    uint32_t const str_count,
+    char const petscii_not_found_replacer);
+
 /**
  * - Fills given len with length of return value in byte.
  * - Caller takes ownership of return value.
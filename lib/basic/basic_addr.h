@@ -7,5 +7,7 @@
 #define MT_BASIC_ADDR_PET 0x0401 // 1025
 #define MT_BASIC_ADDR_VIC 0x1001 // 4097
 #define MT_BASIC_ADDR_C64 0x0801 // 2049
+#define MT_BASIC_ADDR_TED 0x1001 // 4097 (C16 and Plus/4)
+#define MT_BASIC_ADDR_C128 0x1C01 // 7169
 
 #endif  //MT_BASIC_ADDR
@@ -0,0 +1,452 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "d64.h"
+#include "../alloc/alloc.h"
+#include "../str/str.h"
+#include "../dir/dir.h"
+#include "../filesys/filesys.h"
+#include "../ff14/source/ff.h"
+
+#ifndef NDEBUG
+    #include "../console/console.h"
+#endif //NDEBUG
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MT_D64_SECTOR_LEN 256
+#define MT_D64_DATA_LEN 254 // Per sector (following link to next sector).
+#define MT_D64_SECTOR_COUNT_35 683 // Of image with 35 tracks.
+#define MT_D64_SECTOR_COUNT_40 768 // Of image with 40 tracks.
+#define MT_D64_DIR_TRACK 18 // BAM in sector 0, followed by directory.
+#define MT_D64_DISK_NAME_OFFSET 0x90 // In BAM.
+#define MT_D64_ENTRY_LEN 32 // Of a directory entry.
+#define MT_D64_ENTRIES_PER_SECTOR 8
+#define MT_D64_MAX_FILE_COUNT 144 // A 1541 directory holds no more entries.
+#define MT_D64_NAME_PAD 0xA0 // Shifted space.
+
+struct file
+{
+    char name[MT_D64_NAME_LEN + 1];
+    uint32_t byte_count;
+    uint32_t sector_count;
+    uint32_t * offsets; // Of file's sectors in image, in order of chain.
+};
+
+static char * s_path = 0; // Full path of mounted image, 0 if not mounted.
+static char (*s_get_name_char)(uint8_t const c) = 0;
+static FSIZE_t s_size = 0; // Of image file at mount.
+static WORD s_date = 0; // Of last modification of image file at mount.
+static WORD s_time = 0;
+static char s_disk_name[MT_D64_NAME_LEN + 1];
+static struct file * s_files = 0; // In order of image's directory.
+static int s_file_count = 0;
+
+static uint32_t get_sectors_per_track(uint32_t const track)
+{
+    if(track <= 17)
+    {
+        return 21;
+    }
+    if(track <= 24)
+    {
+        return 19;
+    }
+    if(track <= 30)
+    {
+        return 18;
+    }
+    return 17;
+}
+
+/** Return count of sectors of image with given file size.
+ *
+ * - Returns 0, if size is not the one of a supported image.
+ */
+static uint32_t get_sector_count(FSIZE_t const size)
+{
+    // (images may hold one error byte per sector after the sectors)
+
+    if(size == MT_D64_SECTOR_COUNT_35 * MT_D64_SECTOR_LEN
+        || size == MT_D64_SECTOR_COUNT_35 * (MT_D64_SECTOR_LEN + 1))
+    {
+        return MT_D64_SECTOR_COUNT_35;
+    }
+    if(size == MT_D64_SECTOR_COUNT_40 * MT_D64_SECTOR_LEN
+        || size == MT_D64_SECTOR_COUNT_40 * (MT_D64_SECTOR_LEN + 1))
+    {
+        return MT_D64_SECTOR_COUNT_40;
+    }
+    return 0;
+}
+
+/** Return offset of sector at given track and sector numbers in image with
+ *  given count of sectors.
+ *
+ * - Returns UINT32_MAX, if there is no such sector.
+ */
+static uint32_t get_offset(
+    uint8_t const track, uint8_t const sector, uint32_t const sector_count)
+{
+    uint32_t const track_count = sector_count == MT_D64_SECTOR_COUNT_40
+        ? 40 : 35;
+    uint32_t sectors_before = 0;
+
+    if(track == 0
+        || (uint32_t)track > track_count
+        || (uint32_t)sector >= get_sectors_per_track(track))
+    {
+        return UINT32_MAX;
+    }
+    for(uint32_t t = 1;t < (uint32_t)track;++t)
+    {
+        sectors_before += get_sectors_per_track(t);
+    }
+    return (sectors_before + (uint32_t)sector) * MT_D64_SECTOR_LEN;
+}
+
+/** Convert given name padded with shifted spaces via s_get_name_char.
+ */
+static void get_name(char * const out, uint8_t const * const raw)
+{
+    int len = 0;
+
+    while(len < MT_D64_NAME_LEN && raw[len] != MT_D64_NAME_PAD)
+    {
+        out[len] = s_get_name_char(raw[len]);
+        ++len;
+    }
+    out[len] = '\0';
+}
+
+/** Follow chain of sectors starting at given track and sector in given image
+ *  and store it in given file object.
+ *
+ * - Returns false, if chain is invalid (e.g. a loop).
+ */
+static bool fill_chain(
+    struct file * const f,
+    uint8_t const * const img,
+    uint32_t const sector_count,
+    uint8_t const track,
+    uint8_t const sector)
+{
+    uint32_t count = 0,
+        offset = get_offset(track, sector, sector_count);
+
+    while(true) // Count sectors.
+    {
+        if(offset == UINT32_MAX || count == sector_count)
+        {
+            return false;
+        }
+        ++count;
+        if(img[offset] == 0)
+        {
+            break; // Last sector.
+        }
+        offset = get_offset(img[offset], img[offset + 1], sector_count);
+    }
+
+    f->offsets = alloc_alloc(count * sizeof *f->offsets);
+    if(f->offsets == 0)
+    {
+        return false;
+    }
+    f->sector_count = count;
+
+    offset = get_offset(track, sector, sector_count);
+    for(uint32_t i = 0;i < count;++i)
+    {
+        f->offsets[i] = offset;
+        if(i + 1 < count)
+        {
+            offset = get_offset(img[offset], img[offset + 1], sector_count);
+        }
+    }
+
+    // Second byte of last sector holds index of last byte used:
+    //
+    f->byte_count = (count - 1) * MT_D64_DATA_LEN
+        + (img[offset + 1] < 2 ? 0 : (uint32_t)img[offset + 1] - 1);
+    return true;
+}
+
+static void free_files()
+{
+    for(int i = 0;i < s_file_count;++i)
+    {
+        alloc_free(s_files[i].offsets);
+    }
+    alloc_free(s_files);
+    s_files = 0;
+    s_file_count = 0;
+}
+
+/** Parse directory of given image into index.
+ */
+static bool parse(uint8_t const * const img, uint32_t const sector_count)
+{
+    uint8_t const * const bam = img
+        + get_offset(MT_D64_DIR_TRACK, 0, sector_count);
+    uint32_t offset = get_offset(bam[0], bam[1], sector_count),
+        dir_sector_count = 0; // (to detect a loop)
+
+    get_name(s_disk_name, bam + MT_D64_DISK_NAME_OFFSET);
+
+    s_files = alloc_alloc(MT_D64_MAX_FILE_COUNT * sizeof *s_files);
+    if(s_files == 0)
+    {
+        return false;
+    }
+
+    while(offset != UINT32_MAX
+        && dir_sector_count < sector_count
+        && s_file_count < MT_D64_MAX_FILE_COUNT)
+    {
+        uint8_t const * const dir_sector = img + offset;
+
+        for(int i = 0;i < MT_D64_ENTRIES_PER_SECTOR;++i)
+        {
+            uint8_t const * const e = dir_sector + i * MT_D64_ENTRY_LEN;
+            uint8_t const type = e[2] & 0x07;
+            struct file * const f = s_files + s_file_count;
+
+            if((e[2] & 0x80) == 0 // Deleted or not closed.
+                || type < 1 || type > 3 // Not SEQ, PRG or USR.
+                || s_file_count == MT_D64_MAX_FILE_COUNT)
+            {
+                continue;
+            }
+            if(!fill_chain(f, img, sector_count, e[3], e[4]))
+            {
+#ifndef NDEBUG
+                console_writeline("d64/parse : Skipped entry (invalid chain).");
+#endif //NDEBUG
+                continue;
+            }
+            get_name(f->name, e + 5);
+            ++s_file_count;
+        }
+
+        offset = dir_sector[0] == 0
+            ? UINT32_MAX // Last directory sector.
+            : get_offset(dir_sector[0], dir_sector[1], sector_count);
+        ++dir_sector_count;
+    }
+    return true;
+}
+
+/** Return true, if mounted image is still the same on SD card.
+ */
+static bool is_unchanged()
+{
+    FILINFO info;
+
+    return f_stat(s_path, &info) == FR_OK
+        && info.fsize == s_size
+        && info.fdate == s_date
+        && info.ftime == s_time;
+}
+
+/** Mount mounted image again, if it got changed on SD card.
+ */
+static bool refresh()
+{
+    if(s_path == 0)
+    {
+        return false;
+    }
+
+    filesys_mount();
+    if(is_unchanged())
+    {
+        return true;
+    }
+
+    char * const full_path = str_create_copy(s_path);
+    bool const ret_val = d64_mount(full_path, s_get_name_char);
+
+    alloc_free(full_path);
+    return ret_val;
+}
+
+bool d64_mount(
+    char const * const full_path, char (*get_name_char)(uint8_t const c))
+{
+    FIL fil;
+    FILINFO info;
+    UINT read_len = 0;
+
+    d64_unmount();
+    filesys_mount();
+
+    if(f_stat(full_path, &info) != FR_OK || (info.fattrib & AM_DIR) != 0)
+    {
+        return false;
+    }
+
+    uint32_t const sector_count = get_sector_count(info.fsize);
+
+    if(sector_count == 0)
+    {
+        return false;
+    }
+
+    uint32_t const len = sector_count * MT_D64_SECTOR_LEN;
+    uint8_t * const img = alloc_alloc(len); // (no error bytes)
+
+    if(img == 0)
+    {
+        return false;
+    }
+    if(f_open(&fil, full_path, FA_READ) != FR_OK)
+    {
+        alloc_free(img);
+        return false;
+    }
+    f_read(&fil, img, (UINT)len, &read_len);
+    f_close(&fil);
+
+    s_get_name_char = get_name_char;
+
+    bool const ret_val = (uint32_t)read_len == len && parse(img, sector_count);
+
+    alloc_free(img);
+    if(!ret_val)
+    {
+        free_files();
+        return false;
+    }
+
+    s_path = str_create_copy(full_path);
+    s_size = info.fsize;
+    s_date = info.fdate;
+    s_time = info.ftime;
+
+#ifndef NDEBUG
+    console_write("d64_mount : Mounted \"");
+    console_write(s_path);
+    console_write("\" with ");
+    console_write_dword_dec((uint32_t)s_file_count);
+    console_writeline(" file(-s).");
+#endif //NDEBUG
+    return true;
+}
+
+void d64_unmount()
+{
+    free_files();
+    alloc_free(s_path);
+    s_path = 0;
+}
+
+bool d64_is_mounted()
+{
+    return s_path != 0;
+}
+
+char const * d64_get_disk_name()
+{
+    return s_disk_name;
+}
+
+struct dir_entry * * d64_create_entry_arr(
+    char const * const pattern, int * const count)
+{
+    *count = 0;
+
+    if(!refresh())
+    {
+        return 0;
+    }
+
+    struct dir_entry * * const ret_val = alloc_alloc(
+        (s_file_count + 1) * sizeof *ret_val); // (+1 for empty image)
+
+    if(ret_val == 0)
+    {
+        return 0;
+    }
+    for(int i = 0;i < s_file_count;++i)
+    {
+        if(pattern != 0 && !str_is_matching(s_files[i].name, pattern))
+        {
+            continue;
+        }
+
+        struct dir_entry * const e = alloc_alloc(sizeof *e);
+
+        e->name = str_create_copy(s_files[i].name);
+        e->is_dir = false;
+        e->size = s_files[i].byte_count;
+        ret_val[*count] = e;
+        ++(*count);
+    }
+    return ret_val;
+}
+
+uint8_t * d64_load(char const * const pattern, uint32_t * const out_byte_count)
+{
+    FIL fil;
+    uint32_t done = 0;
+    struct file const * f = 0;
+
+    *out_byte_count = 0;
+
+    if(!refresh())
+    {
+        return 0;
+    }
+    for(int i = 0;i < s_file_count;++i)
+    {
+        if(str_is_matching(s_files[i].name, pattern))
+        {
+            f = s_files + i;
+            break;
+        }
+    }
+    if(f == 0 || f_open(&fil, s_path, FA_READ) != FR_OK)
+    {
+        return 0;
+    }
+
+    uint8_t * const ret_val = alloc_alloc(f->byte_count + 1);
+    //
+    // (+1 to support empty files, like filesys_load())
+    DWORD * const clmt = filesys_create_clmt(&fil);
+
+    fil.cltbl = clmt; // (seeks without following the FAT, if not 0)
+
+    for(uint32_t i = 0;ret_val != 0 && i < f->sector_count;++i)
+    {
+        FSIZE_t const pos = (FSIZE_t)f->offsets[i] + 2; // Skips link.
+        uint32_t const len = f->byte_count - done < MT_D64_DATA_LEN
+            ? f->byte_count - done
+            : MT_D64_DATA_LEN;
+        UINT read_len = 0;
+
+        if((f_tell(&fil) != pos && f_lseek(&fil, pos) != FR_OK)
+            || f_read(&fil, ret_val + done, (UINT)len, &read_len) != FR_OK
+            || (uint32_t)read_len != len)
+        {
+            alloc_free(ret_val);
+            fil.cltbl = 0;
+            alloc_free(clmt);
+            f_close(&fil);
+            return 0;
+        }
+        done += len;
+    }
+
+    fil.cltbl = 0;
+    alloc_free(clmt);
+    f_close(&fil);
+
+    if(ret_val != 0)
+    {
+        *out_byte_count = done;
+    }
+    return ret_val;
+}
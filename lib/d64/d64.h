@@ -0,0 +1,67 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Singleton (!) to use a D64 disk image file (of a Commodore 1541 floppy disk)
+// on the SD card like a folder.
+//
+// - The image's directory is parsed once on mount into an index holding each
+//   file's chain of track/sector pairs (as offsets of sectors in the image
+//   file), so files are loaded by reading their sectors straight from the
+//   image (no extraction to a temporary file).
+// - Supports images of 35 and 40 tracks (with or without error bytes).
+// - Read-only, for now.
+
+#ifndef MT_D64
+#define MT_D64
+
+#include "../dir/dir.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MT_D64_NAME_LEN 16 // Of disk and file names.
+
+/** Mount D64 image at given full path, parsing its directory.
+ *
+ * - Unmounts image mounted before, if any.
+ * - Given function converts a PETSCII character of a name to the character
+ *   to be used in the index (e.g. to compare with names given by the
+ *   Commodore machine).
+ * - Returns false, if the file is not a valid D64 image.
+ */
+bool d64_mount(
+    char const * const full_path, char (*get_name_char)(uint8_t const c));
+
+/**
+ * - OK to be called, if not mounted.
+ */
+void d64_unmount();
+
+bool d64_is_mounted();
+
+/** Return name of disk mounted (e.g. as header of a listing).
+ */
+char const * d64_get_disk_name();
+
+/** Return array of the files in mounted image whose names match given
+ *  pattern [see str_is_matching()], or of all files, if pattern is 0.
+ *
+ * - In order of image's directory, sizes in byte.
+ * - Caller takes ownership of returned object [see dir_free_entry_arr()].
+ * - Returns 0 on error.
+ */
+struct dir_entry * * d64_create_entry_arr(
+    char const * const pattern, int * const count);
+
+/** Load content of first file in mounted image whose name matches given
+ *  pattern [see str_is_matching()] and set byte count.
+ *
+ * - Reads the file's sectors directly from the image (seeking via FatFs
+ *   fast seek, so without following the FAT).
+ * - Re-parses the image, if its size or time stamp changed since mount.
+ * - Caller takes ownership of returned object.
+ * - Returns 0 on error (e.g. if not found).
+ */
+uint8_t * d64_load(char const * const pattern, uint32_t * const out_byte_count);
+
+#endif //MT_D64
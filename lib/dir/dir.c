@@ -4,6 +4,7 @@
 #include "dir.h"
 #include "../alloc/alloc.h"
 #include "../sort/sort.h"
+#include "../calc/calc.h"
 #include "../str/str.h"
 #include "../ff14/source/ff.h"
 
@@ -14,9 +15,59 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Count of folders to keep sorted entries of in RAM:
+//
+#define MT_DIR_INDEX_MAX_COUNT 8
+
+/** Entry of a folder index.
+ *
+ * - Given to callers as struct dir_entry (must be first member), holding the
+ *   entry's alias as name.
+ */
+struct index_entry
+{
+    struct dir_entry e;
+    char * long_name; // Name on SD card.
+    char * key; // Name on SD card in upper case (to sort and look up by).
+    uint32_t stamp; // FAT modification date (high word) and time (low word).
+    //
+    // (unknown, if 0, e.g. after entry got changed)
+};
+
+struct dir_index
+{
+    char * path; // Folder path in upper case.
+    struct dir_entry * * arr; // Sorted via cmp_dir_entry().
+    int len;
+    int cap;
+
+    // Hash table of entries by key and by alias for O(1) lookups (open
+    // addressing with linear probing, four times the capacity of arr, so at
+    // most half full):
+    //
+    struct index_entry * * table;
+    uint32_t table_mask; // (table's length minus one)
+
+    struct dir_index * next; // Less recently used index or 0.
+};
+
 static DIR * s_dir = 0;
 static char * s_dir_path = 0;
 
+static struct dir_index * s_index = 0; // Most recently used index.
+
+static uint32_t s_index_change_count = 0; // See dir_get_index_change_count().
+
+// Converts a character of a name into the one to use for an alias (0 <=>
+// letters to upper case, only):
+//
+static char (*s_get_alias_char)(char const c) = 0;
+
+// Tells, if an entry is left out of indexes (0 <=> none):
+//
+static bool (*s_is_hidden)(
+    char const * const dir_path, char const * const name) = 0;
+
 static bool rewind()
 {
     if(s_dir == 0)
@@ -73,12 +124,25 @@ static bool init(char const * const dir_path)
     return true;
 }
 
+bool dir_rewind()
+{
+    return rewind();
+}
+
 char const * dir_get_dir_path()
 {
     return s_dir_path;
 }
 
 char* dir_create_name_of_next_entry(bool * const is_dir)
+{
+    uint32_t size = 0;
+
+    return dir_create_name_and_size_of_next_entry(is_dir, &size);
+}
+
+char* dir_create_name_and_size_of_next_entry(
+    bool * const is_dir, uint32_t * const size)
 {
     FILINFO info;
 
@@ -91,7 +155,7 @@ char* dir_create_name_of_next_entry(bool * const is_dir)
         return 0;
     }
 
-    if(is_dir == 0)
+    if(is_dir == 0 || size == 0)
     {
         return 0;
     }
@@ -102,120 +166,633 @@ char* dir_create_name_of_next_entry(bool * const is_dir)
     }
 
     *is_dir = (info.fattrib & AM_DIR) != 0;
+    *size = (uint32_t)info.fsize;
 
     return str_create_copy(info.fname);
 }
 
+static int cmp_index_entry(void const * const a, void const * const b)
+{
+    struct index_entry const * const e_a =
+        *(struct index_entry const * const *)a;
+    struct index_entry const * const e_b =
+        *(struct index_entry const * const *)b;
+
+    if(e_a->e.is_dir != e_b->e.is_dir)
+    {
+        if(e_a->e.is_dir)
+        {
+            return -1;
+        }
+        return 1;
+    }
+    return str_cmp(e_a->key, e_b->key);
+}
+
+void dir_free_entry_arr(struct dir_entry * * arr, int const len)
+{
+    for(int i = 0;i < len;++i)
+    {
+        alloc_free(arr[i]->name);
+        arr[i]->name = 0;
+
+        alloc_free(arr[i]);
+    }
+    alloc_free(arr);
+}
+
 /**
  * - Caller takes ownership of returned object.
  */
-static struct dir_entry * create_entry_from_next_entry()
+static char * create_key(char const * const dir_path)
 {
-    struct dir_entry * entry = 0;
+    char * const ret_val = str_create_copy(dir_path);
 
-    if(s_dir == 0)
+    str_to_upper(ret_val, ret_val); // (FAT file names ignore letter case)
+    return ret_val;
+}
+
+/** Free members of given index entry that are not members of struct
+ *  dir_entry.
+ */
+static void free_long_name_and_key(struct index_entry * const entry)
+{
+    alloc_free(entry->long_name);
+    entry->long_name = 0;
+    alloc_free(entry->key);
+    entry->key = 0;
+}
+
+static void free_index(struct dir_index * const index)
+{
+    ++s_index_change_count;
+    alloc_free(index->table);
+    for(int i = 0;i < index->len;++i)
     {
-        return 0;
+        free_long_name_and_key((struct index_entry *)index->arr[i]);
     }
-    if(s_dir_path == 0)
+    dir_free_entry_arr(index->arr, index->len);
+    alloc_free(index->path);
+    alloc_free(index);
+}
+
+/** Return FNV-1a hash of given name.
+ */
+static uint32_t get_hash(char const * const name)
+{
+    uint32_t ret_val = 2166136261u;
+
+    for(char const * c = name;*c != '\0';++c)
     {
-        return 0;
+        ret_val = (ret_val ^ (uint32_t)(uint8_t)*c) * 16777619u;
     }
+    return ret_val;
+}
+
+/** Add given entry to hash table of given index via given string (its key or
+ *  alias), table must not be full.
+ */
+static void put_entry(
+    struct dir_index * const index,
+    struct index_entry * const entry,
+    char const * const str)
+{
+    uint32_t i = get_hash(str) & index->table_mask;
 
-    entry = alloc_alloc(sizeof *entry);
-    if(entry == 0)
+    while(index->table[i] != 0)
     {
-        return 0;
+        i = (i + 1) & index->table_mask;
     }
+    index->table[i] = entry;
+}
 
-    entry->name = dir_create_name_of_next_entry(&entry->is_dir);
-    if(entry->name == 0)
+/** Add given entry to hash table of given index via its alias, if it has one
+ *  differing from its key.
+ */
+static void put_alias(
+    struct dir_index * const index, struct index_entry * const entry)
+{
+    if(entry->e.name[0] != '\0' && !str_are_equal(entry->e.name, entry->key))
     {
-        alloc_free(entry);
-        return 0;
+        put_entry(index, entry, entry->e.name);
     }
+}
 
-    return entry;
+/** (Re-)create hash table of given index with four times its capacity as
+ *  length (room for key and alias of each entry).
+ */
+static bool create_table(struct dir_index * const index)
+{
+    uint32_t const len = 4 * (uint32_t)index->cap;
+    struct index_entry * * const table = alloc_alloc(len * sizeof *table);
+
+    if(table == 0)
+    {
+        return false;
+    }
+    for(uint32_t i = 0;i < len;++i)
+    {
+        table[i] = 0;
+    }
+    alloc_free(index->table);
+    index->table = table;
+    index->table_mask = len - 1; // (capacity is a power of two)
+
+    for(int i = 0;i < index->len;++i)
+    {
+        struct index_entry * const entry = (struct index_entry *)index->arr[i];
+
+        put_entry(index, entry, entry->key);
+        put_alias(index, entry);
+    }
+    return true;
 }
 
-static int cmp_dir_entry(void const * const a, void const * const b)
+/** Return entry with given key or alias (in upper case) from hash table of
+ *  given index, or 0.
+ */
+static struct index_entry * get_hashed_entry(
+    struct dir_index const * const index, char const * const name)
 {
-    struct dir_entry const * const e_a = *(struct dir_entry const * const *)a;
-    struct dir_entry const * const e_b = *(struct dir_entry const * const *)b;
+    uint32_t i = 0;
+
+    if(index->table == 0)
+    {
+        return 0; // (no entries)
+    }
 
-    if(e_a->is_dir != e_b->is_dir)
+    i = get_hash(name) & index->table_mask;
+    while(index->table[i] != 0)
     {
-        if(e_a->is_dir)
+        if(str_are_equal(index->table[i]->key, name)
+            || str_are_equal(index->table[i]->e.name, name))
         {
-            return -1;
+            return index->table[i];
         }
-        return 1;
+        i = (i + 1) & index->table_mask;
     }
-    return str_cmp(e_a->name, e_b->name);
+    return 0;
 }
 
-/**
- * - Rewinds to first entry!
- * - Returns -1 in error.
+/** Add given entry at given position to given index.
  */
-static int get_entry_count()
+static bool insert_entry(
+    struct dir_index * const index,
+    int const pos,
+    struct index_entry * const entry)
 {
-    int count = 0;
-    FILINFO info;
+    if(index->len == index->cap)
+    {
+        int const cap = index->cap == 0 ? 16 : 2 * index->cap;
+        struct dir_entry * * const arr = alloc_alloc(cap * sizeof *arr);
 
-    if(s_dir == 0)
+        if(arr == 0)
+        {
+            return false;
+        }
+        for(int i = 0;i < index->len;++i)
+        {
+            arr[i] = index->arr[i];
+        }
+        alloc_free(index->arr);
+        index->arr = arr;
+        index->cap = cap;
+
+        if(!create_table(index))
+        {
+            return false;
+        }
+    }
+
+    for(int i = index->len;i > pos;--i)
     {
-        return -1;
+        index->arr[i] = index->arr[i - 1];
     }
-    if(s_dir_path == 0)
+    index->arr[pos] = &entry->e;
+    ++index->len;
+    put_entry(index, entry, entry->key);
+    return true;
+}
+
+static char get_alias_char(char const c)
+{
+    if(s_get_alias_char != 0)
     {
-        return -1;
+        return s_get_alias_char(c);
     }
+    return 'a' <= c && c <= 'z' ? (char)(c - ('a' - 'A')) : c;
+}
+
+/** Fill given buffer with alias created from given name, with given number
+ *  (if not zero) as suffix of the name without extension.
+ *
+ * - Cuts name without extension to make alias fit into MT_DIR_ALIAS_LEN
+ *   characters, keeping an extension of up to three characters.
+ */
+static void fill_alias(
+    char * const out, char const * const name, uint32_t const nr)
+{
+    char suffix[1 + 10 + 1]; // '-', up to ten digits and '\0'.
+    int const len = (int)str_get_len(name);
+    int dot = str_get_last_index(name, '.'),
+        body_len = 0,
+        suffix_len = 0,
+        i = 0;
 
-    if(!rewind())
+    if(dot < 1 || len - dot - 1 < 1 || len - dot - 1 > 3)
     {
-        return -1;
+        dot = len; // No extension to keep.
     }
+    if(nr > 0)
+    {
+        char dec[10];
+        int k = 0;
 
-    do
+        calc_dword_to_dec(nr, dec);
+        while(k < 9 && dec[k] == '0')
+        {
+            ++k; // Skips leading zeros.
+        }
+        suffix[suffix_len++] = '-'; // (can be typed at Commodore machines)
+        while(k < 10)
+        {
+            suffix[suffix_len++] = dec[k++];
+        }
+    }
+    suffix[suffix_len] = '\0';
+
+    body_len = dot;
+    if(body_len + suffix_len + (len - dot) > MT_DIR_ALIAS_LEN)
+    {
+        body_len = MT_DIR_ALIAS_LEN - suffix_len - (len - dot);
+    }
+    for(int k = 0;k < body_len;++k)
+    {
+        out[i++] = get_alias_char(name[k]);
+    }
+    while(i > 0 && out[i - 1] == ' ')
+    {
+        --i; // (trailing blanks are not sent by Commodore machines)
+    }
+    for(int k = 0;k < suffix_len;++k)
     {
-        if(f_readdir(s_dir, &info) != FR_OK)
+        out[i++] = get_alias_char(suffix[k]);
+    }
+    for(int k = dot;k < len;++k)
+    {
+        out[i++] = get_alias_char(name[k]);
+    }
+    out[i] = '\0';
+}
+
+/** Try to set alias of given entry to alias with given number (see
+ *  fill_alias()), succeeds, if no other entry of given index uses it as
+ *  alias or key.
+ */
+static bool try_alias(
+    struct dir_index * const index,
+    struct index_entry * const entry,
+    uint32_t const nr)
+{
+    char alias[MT_DIR_ALIAS_LEN + 1];
+    struct index_entry const * other = 0;
+
+    fill_alias(alias, entry->long_name, nr);
+    if(alias[0] == '\0')
+    {
+        return false;
+    }
+    other = get_hashed_entry(index, alias);
+    if(other != 0 && other != entry)
+    {
+        return false;
+    }
+    str_copy(entry->e.name, alias);
+    put_alias(index, entry);
+    return true;
+}
+
+/** Set alias of given entry (without one, yet) to first free alias.
+ */
+static void set_alias(
+    struct dir_index * const index, struct index_entry * const entry)
+{
+    uint32_t nr = 1;
+
+    while(!try_alias(index, entry, nr))
+    {
+        ++nr;
+    }
+}
+
+/** Set aliases of all entries of given index (without aliases, yet).
+ *
+ * - Names fitting as they are get their alias first, so only entries with
+ *   names too long (or otherwise colliding) get numbered aliases.
+ */
+static void set_aliases(struct dir_index * const index)
+{
+    for(int i = 0;i < index->len;++i)
+    {
+        try_alias(index, (struct index_entry *)index->arr[i], 0);
+    }
+    for(int i = 0;i < index->len;++i)
+    {
+        struct index_entry * const entry = (struct index_entry *)index->arr[i];
+
+        if(entry->e.name[0] == '\0')
         {
-            return -1;
+            set_alias(index, entry);
+        }
+    }
+}
+
+/** Create entry with given name (as on SD card), without alias.
+ *
+ * - Caller takes ownership of returned object.
+ */
+static struct index_entry * create_entry(
+    char const * const name, bool const is_dir, uint32_t const size)
+{
+    struct index_entry * const entry = alloc_alloc(sizeof *entry);
+
+    entry->e.name = alloc_alloc((MT_DIR_ALIAS_LEN + 1) * sizeof *entry->e.name);
+    entry->e.name[0] = '\0';
+    entry->e.is_dir = is_dir;
+    entry->e.size = size;
+    entry->long_name = str_create_copy(name);
+    entry->key = str_create_copy(name);
+    str_to_upper(entry->key, entry->key);
+    entry->stamp = 0;
+    return entry;
+}
+
+static void free_entry(struct index_entry * const entry)
+{
+    free_long_name_and_key(entry);
+    alloc_free(entry->e.name);
+    alloc_free(entry);
+}
+
+/** Read all entries of folder at given path in one pass and sort them.
+ *
+ * - Does not use (and does not rewind) the singleton's folder.
+ * - Returns 0 on error.
+ */
+static struct dir_index * create_index(char const * const dir_path)
+{
+    struct dir_index * const index = alloc_alloc(sizeof *index);
+    DIR * const d = alloc_alloc(sizeof *d);
+    FILINFO info;
+    bool is_err = false;
+
+    index->path = create_key(dir_path);
+    index->arr = 0;
+    index->len = 0;
+    index->cap = 0;
+    index->table = 0;
+    index->table_mask = 0;
+    index->next = 0;
+
+    if(f_opendir(d, dir_path) != FR_OK)
+    {
+        alloc_free(d);
+        free_index(index);
+        return 0;
+    }
+    while(true)
+    {
+        if(f_readdir(d, &info) != FR_OK)
+        {
+            is_err = true;
+            break;
         }
         if(info.fname[0] == '\0')
         {
+            break; // Done.
+        }
+        if(s_is_hidden != 0 && s_is_hidden(dir_path, info.fname))
+        {
+            continue;
+        }
+
+        struct index_entry * const entry = create_entry(
+            info.fname,
+            (info.fattrib & AM_DIR) != 0,
+            (uint32_t)info.fsize);
+
+        entry->stamp = ((uint32_t)info.fdate << 16) | (uint32_t)info.ftime;
+
+        if(!insert_entry(index, index->len, entry)) // (appends)
+        {
+            free_entry(entry);
+            is_err = true;
             break;
         }
+    }
+    f_closedir(d);
+    alloc_free(d);
+
+    if(is_err)
+    {
+        free_index(index);
+        return 0;
+    }
+
+    sort_ptr_intro((void * *)index->arr, (size_t)index->len, cmp_index_entry);
+    set_aliases(index); // (in sorted order, to be reproducible)
+
+#ifndef NDEBUG
+    console_write("dir/create_index : Indexed ");
+    console_write_dword_dec((uint32_t)index->len);
+    console_write(" entries of \"");
+    console_write(dir_path);
+    console_writeline("\".");
+#endif //NDEBUG
+    return index;
+}
+
+/** Return pointer to pointer to cached index of folder with given key (path
+ *  in upper case), or to pointer holding 0.
+ */
+static struct dir_index * * find_index(char const * const key)
+{
+    struct dir_index * * p = &s_index;
+
+    while(*p != 0 && !str_are_equal((*p)->path, key))
+    {
+        p = &((*p)->next);
+    }
+    return p;
+}
 
-        ++count;
-    }while(true);
+/** Return cached index of folder at given path or create (and cache) it.
+ *
+ * - Returns 0 on error.
+ */
+static struct dir_index * get_index(char const * const dir_path)
+{
+    char * const key = create_key(dir_path);
+    struct dir_index * * const p = find_index(key);
+    struct dir_index * index = *p;
 
-    if(!rewind())
+    alloc_free(key);
+    if(index != 0)
     {
-        return -1;
+        *p = index->next; // Makes it the most recently used one.
     }
+    else
+    {
+        int count = 1;
+        struct dir_index * * last = &s_index;
 
-    return count;
+        index = create_index(dir_path);
+        if(index == 0)
+        {
+            return 0;
+        }
+
+        // Forget least recently used index, if too many:
+        //
+        while(*last != 0 && count < MT_DIR_INDEX_MAX_COUNT)
+        {
+            last = &((*last)->next);
+            ++count;
+        }
+        if(*last != 0)
+        {
+            free_index(*last);
+            *last = 0;
+        }
+    }
+    index->next = s_index;
+    s_index = index;
+    return index;
 }
 
-void dir_free_entry_arr(struct dir_entry * * arr, int const len)
+/** Return position of entry with given key (name on SD card in upper case) in
+ *  given index, or position to insert it at (sets is_found to false), via
+ *  binary search.
+ */
+static int find_entry(
+    struct dir_index const * const index,
+    char const * const key,
+    bool const is_dir,
+    bool * const is_found)
 {
-    for(int i = 0;i < len;++i)
+    struct index_entry const e = {
+        .e = { .is_dir = is_dir }, .key = (char *)key
+    };
+    struct index_entry const * const p = &e;
+    int beg = 0, lim = index->len;
+
+    while(beg < lim)
     {
-        alloc_free(arr[i]->name);
-        arr[i]->name = 0;
+        int const mid = beg + (lim - beg) / 2;
+        int const c = cmp_index_entry(&index->arr[mid], &p);
 
-        alloc_free(arr[i]);
+        if(c == 0)
+        {
+            *is_found = true;
+            return mid;
+        }
+        if(c < 0)
+        {
+            beg = mid + 1;
+        }
+        else
+        {
+            lim = mid;
+        }
     }
-    alloc_free(arr);
+    *is_found = false;
+    return beg;
+}
+
+/** Return entry with given name or alias (letter case ignored) in folder
+ *  given by path, or 0, via hash table of folder's index.
+ *
+ * - Returns 0 and sets is_err to true, if index could not be created.
+ * - Sets index to folder's index (if not 0).
+ */
+static struct index_entry * get_entry(
+    char const * const dir_path,
+    char const * const name,
+    bool * const is_err,
+    struct dir_index * * const out_index)
+{
+    struct dir_index * const index = get_index(dir_path);
+    char * upper = 0;
+    struct index_entry * ret_val = 0;
+
+    *is_err = index == 0;
+    if(out_index != 0)
+    {
+        *out_index = index;
+    }
+    if(index == 0)
+    {
+        return 0;
+    }
+
+    upper = str_create_copy(name);
+    str_to_upper(upper, upper);
+    ret_val = get_hashed_entry(index, upper);
+    alloc_free(upper);
+    return ret_val;
+}
+
+/** Split given full path into folder path and entry name.
+ *
+ * - Caller takes ownership of returned folder path.
+ * - Returns 0, if given path holds no '/'.
+ */
+static char * create_dir_path(
+    char const * const full_path, char const * * const name)
+{
+    int const slash = str_get_last_index(full_path, '/');
+
+    if(slash == -1)
+    {
+        return 0;
+    }
+    *name = full_path + slash + 1;
+    return slash == 0
+        ? str_create_copy("/")
+        : str_create_partial_copy(full_path, 0, (uint32_t)slash);
+}
+
+struct dir_entry const * const * dir_get_entry_arr(int * const count)
+{
+    struct dir_index const * index = 0;
+
+    if(s_dir_path == 0)
+    {
+        *count = -1;
+        return 0;
+    }
+
+    index = get_index(s_dir_path);
+    if(index == 0)
+    {
+        *count = -1;
+        return 0;
+    }
+    *count = index->len;
+    return (struct dir_entry const * const *)index->arr;
+}
+
+uint32_t dir_get_index_change_count()
+{
+    return s_index_change_count;
 }
 
 struct dir_entry * * dir_create_entry_arr(int * const count)
 {
+    struct dir_entry const * const * const index_arr = dir_get_entry_arr(
+        count);
     struct dir_entry * * arr = 0;
 
-    *count = get_entry_count(); // (rewinds)
     if(*count <= 0) // -1 <=> error, 0 <=> no entries.
     {
         return 0;
@@ -227,34 +804,162 @@ struct dir_entry * * dir_create_entry_arr(int * const count)
         *count = -1;
         return 0;
     }
+    for(int i = 0;i < *count;++i)
+    {
+        arr[i] = alloc_alloc(sizeof *arr[i]);
+        arr[i]->name = str_create_copy(index_arr[i]->name);
+        arr[i]->is_dir = index_arr[i]->is_dir;
+        arr[i]->size = index_arr[i]->size;
+    }
+    return arr;
+}
+
+void dir_index_set(
+    char const * const full_path, bool const is_dir, uint32_t const size)
+{
+    char const * name = 0;
+    char * const dir_path = create_dir_path(full_path, &name);
 
-    for(int i = 0;i < *count; ++i)
+    if(dir_path == 0)
     {
-        arr[i] = create_entry_from_next_entry();
-        if(arr[i] == 0)
+        return;
+    }
+    if(s_is_hidden != 0 && s_is_hidden(dir_path, name))
+    {
+        alloc_free(dir_path);
+        return;
+    }
+
+    char * const key = create_key(dir_path);
+    struct dir_index * const index = *find_index(key);
+
+    alloc_free(key);
+    alloc_free(dir_path);
+    if(index == 0)
+    {
+        return; // Not cached, nothing to update.
+    }
+    ++s_index_change_count;
+
+    char * const upper = str_create_copy(name);
+    bool is_found = false;
+
+    str_to_upper(upper, upper);
+
+    int const pos = find_entry(index, upper, is_dir, &is_found);
+
+    if(is_found)
+    {
+        struct index_entry * const found = (struct index_entry *)
+            index->arr[pos];
+
+        found->e.size = size;
+        found->stamp = 0; // (read again on next opening)
+        alloc_free(upper);
+        return;
+    }
+
+    // The new entry's name may be the alias of another entry:
+    //
+    bool const is_alias_taken = get_hashed_entry(index, upper) != 0;
+    struct index_entry * const entry = create_entry(name, is_dir, size);
+
+    alloc_free(upper);
+    if(!insert_entry(index, pos, entry))
+    {
+        free_entry(entry);
+        dir_index_clear(); // (better than an outdated index)
+        return;
+    }
+    if(!is_alias_taken)
+    {
+        if(!try_alias(index, entry, 0))
         {
-            dir_free_entry_arr(arr, i);
-            *count = -1;
-            return 0;
+            set_alias(index, entry);
         }
+        return;
     }
 
-    if(!rewind())
+    // Set all aliases again (rare):
+    //
+    for(int i = 0;i < index->len;++i)
     {
-        dir_free_entry_arr(arr, *count);
-        *count = -1;
-        return 0;
+        index->arr[i]->name[0] = '\0';
+    }
+    if(!create_table(index))
+    {
+        dir_index_clear();
+        return;
+    }
+    set_aliases(index);
+}
+
+void dir_index_remove(char const * const full_path)
+{
+    char const * name = 0;
+    char * const dir_path = create_dir_path(full_path, &name);
+
+    if(dir_path == 0)
+    {
+        return;
     }
 
-    sort_insertion(arr, *count, sizeof *arr, cmp_dir_entry);
+    char * const key = create_key(dir_path);
+    struct dir_index * const index = *find_index(key);
 
-    return arr;
+    alloc_free(key);
+    alloc_free(dir_path);
+    if(index == 0)
+    {
+        return;
+    }
+
+    char * const upper = str_create_copy(name);
+    bool is_found = false;
+
+    str_to_upper(upper, upper);
+
+    int pos = find_entry(index, upper, false, &is_found);
+
+    if(!is_found)
+    {
+        pos = find_entry(index, upper, true, &is_found);
+    }
+    alloc_free(upper);
+    if(!is_found)
+    {
+        return;
+    }
+    ++s_index_change_count;
+
+    free_entry((struct index_entry *)index->arr[pos]);
+    --index->len;
+    for(int i = pos;i < index->len;++i)
+    {
+        index->arr[i] = index->arr[i + 1];
+    }
+    if(!create_table(index)) // (removing from probing sequences is not easy)
+    {
+        dir_index_clear(); // (better than an outdated index)
+    }
+}
+
+void dir_index_clear()
+{
+    while(s_index != 0)
+    {
+        struct dir_index * const index = s_index;
+
+        s_index = index->next;
+        free_index(index);
+    }
 }
 
 bool dir_has_sub_dir(char const * const name)
 {
     FILINFO info;
     char* full_path = 0;
+    bool is_err = false;
 
     if(s_dir == 0)
     {
@@ -265,6 +970,15 @@ bool dir_has_sub_dir(char const * const name)
         return false;
     }
 
+    struct index_entry const * const e = get_entry(
+        s_dir_path, name, &is_err, 0);
+
+    if(!is_err)
+    {
+        return e != 0 && e->e.is_dir;
+    }
+    // (otherwise falls back to f_stat())
+
     full_path = dir_create_full_path(s_dir_path, name);
 
     FRESULT const r = f_stat(full_path, &info);
@@ -283,6 +997,7 @@ bool dir_is_file(char const * const name)
 {
     FILINFO info;
     char* full_path = 0;
+    bool is_err = false;
 
     if(s_dir == 0)
     {
@@ -293,6 +1008,15 @@ bool dir_is_file(char const * const name)
         return false;
     }
 
+    struct index_entry const * const e = get_entry(
+        s_dir_path, name, &is_err, 0);
+
+    if(!is_err)
+    {
+        return e != 0 && !e->e.is_dir;
+    }
+    // (otherwise falls back to f_stat())
+
     full_path = dir_create_full_path(s_dir_path, name);
 
     FRESULT const r = f_stat(full_path, &info);
@@ -307,6 +1031,59 @@ bool dir_is_file(char const * const name)
     return (info.fattrib & AM_DIR) == 0;
 }
 
+FRESULT dir_open_file(
+    FIL * const fil,
+    char const * const dir_path,
+    char const * const name,
+    uint32_t * const stamp)
+{
+    struct index_entry * e = 0;
+    bool is_err = true;
+    char * full_path = 0;
+    FRESULT r = FR_OK;
+
+    *stamp = 0;
+
+    if(str_get_last_index(name, '/') == -1) // (otherwise not in folder)
+    {
+        e = get_entry(dir_path, name, &is_err, 0);
+    }
+    if(!is_err && (e == 0 || e->e.is_dir))
+    {
+        return FR_NO_FILE; // Without scanning the folder.
+    }
+
+    full_path = dir_create_full_path(dir_path, e != 0 ? e->long_name : name);
+
+    if(e != 0 && e->stamp != 0)
+    {
+        *stamp = e->stamp; // Without reading the directory entry again.
+    }
+    else
+    {
+        FILINFO info;
+
+        r = f_stat(full_path, &info);
+        if(r == FR_OK)
+        {
+            *stamp = ((uint32_t)info.fdate << 16) | (uint32_t)info.ftime;
+            if(e != 0) // Remember value for next time.
+            {
+                e->stamp = *stamp;
+            }
+        }
+    }
+    if(r == FR_OK)
+    {
+        // FatFs finds the directory entry again, but the folder's sectors
+        // are most likely held by the sector cache (see sectorcache.h):
+        //
+        r = f_open(fil, full_path, FA_READ);
+    }
+    alloc_free(full_path);
+    return r;
+}
+
 bool dir_deinit()
 {
     if(s_dir == 0)
@@ -364,3 +1141,35 @@ char* dir_create_full_path(
     }
     return str_create_concat_three(dir_path, "/", entry_name);
 }
+
+char* dir_create_full_path_of_alias(
+    char const * const dir_path, char const * const name)
+{
+    bool is_err = false;
+    struct index_entry const * const e = str_get_last_index(name, '/') == -1
+        ? get_entry(dir_path, name, &is_err, 0)
+        : 0;
+
+    return dir_create_full_path(dir_path, e != 0 ? e->long_name : name);
+}
+
+void dir_set_alias_char_func(char (*get_alias_char)(char const c))
+{
+    if(s_get_alias_char == get_alias_char)
+    {
+        return;
+    }
+    s_get_alias_char = get_alias_char;
+    dir_index_clear(); // (aliases depend on function)
+}
+
+void dir_set_is_hidden_func(
+    bool (*is_hidden)(char const * const dir_path, char const * const name))
+{
+    if(s_is_hidden == is_hidden)
+    {
+        return;
+    }
+    s_is_hidden = is_hidden;
+    dir_index_clear(); // (entries depend on function)
+}
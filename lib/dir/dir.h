@@ -2,16 +2,30 @@
 // Marcel Timm, RhinoDevel, 2019nov29
 
 // Singleton to get names of subfolders and files in a directory.
+//
+// - Each folder index (see dir_get_entry_arr()) gives every entry an alias of
+//   up to MT_DIR_ALIAS_LEN characters that is unique in the folder (e.g. for
+//   long file names to be used by a Commodore machine). Names fitting are
+//   their own alias (in upper case), others are cut and get a numbered suffix,
+//   if necessary (e.g. "A VERY LONG.PRG" or "A VERY LON-1.PRG" for "A very
+//   long name.prg").
+// - Functions taking names of entries also take aliases.
 
 #ifndef MT_DIR
 #define MT_DIR
 
+#include "../ff14/source/ff.h"
+
 #include <stdbool.h>
+#include <stdint.h>
+
+#define MT_DIR_ALIAS_LEN 16
 
 struct dir_entry
 {
-    char* name;
+    char* name; // Alias, if from folder index (see above).
     bool is_dir;
+    uint32_t size; // In byte (zero for directories).
 };
 
 /**
@@ -30,16 +44,63 @@ char const * dir_get_dir_path();
  */
 char* dir_create_name_of_next_entry(bool * const is_dir);
 
-/** Elements in returned array are always ordered in the same way
- *  (directories first, then files, sub-sorted by name).
+/** Same as dir_create_name_of_next_entry(), but also fills given size with
+ *  the entry's size in byte (zero for directories).
+ */
+char* dir_create_name_and_size_of_next_entry(
+    bool * const is_dir, uint32_t * const size);
+
+/** Make dir_create_name_of_next_entry() start with first entry, again.
+ */
+bool dir_rewind();
+
+/** Return sorted entries of current folder (directories first, then files,
+ *  sub-sorted by name on SD card, letter case ignored) with their aliases as
+ *  names from folder index kept in RAM.
  *
+ * - The index of a folder is created in one pass on first use and updated via
+ *   dir_index_set() and dir_index_remove(), indexes of the least recently used
+ *   folders are forgotten.
+ * - Returned array belongs to the index and is valid until the next call of a
+ *   dir_index_...() function or of this one.
  * - Returns 0 on error (count == -1)
  *   or count of entries being zero (count == 0).
- * - Assumes given pointer not to be set to 0 (no error check).
- * - Rewinds (before array creation and after, if no error occurred).
+ */
+struct dir_entry const * const * dir_get_entry_arr(int * const count);
+
+/** Return count of changes of folder indexes so far.
+ *
+ * - Changes, whenever an array returned by dir_get_entry_arr() may have become
+ *   invalid or its entries may have been modified.
+ */
+uint32_t dir_get_index_change_count();
+
+/** Same as dir_get_entry_arr(), but returns a copy.
+ *
+ * - Caller takes ownership of returned object.
  */
 struct dir_entry * * dir_create_entry_arr(int * const count);
 
+/** Add entry at given full path with given size to index of its folder or
+ *  update its size (e.g. after saving a file).
+ *
+ * - Does nothing, if folder is not indexed.
+ * - Does not use the singleton's folder.
+ */
+void dir_index_set(
+    char const * const full_path, bool const is_dir, uint32_t const size);
+
+/** Remove entry at given full path from index of its folder (e.g. after
+ *  deleting a file).
+ *
+ * - Does nothing, if folder is not indexed.
+ */
+void dir_index_remove(char const * const full_path);
+
+/** Forget indexes of all folders (e.g. after remounting).
+ */
+void dir_index_clear();
+
 /**
  * - Also returns false on error (!).
  */
@@ -50,6 +111,21 @@ bool dir_has_sub_dir(char const * const name);
  */
 bool dir_is_file(char const * const name);
 
+/** Open file with given name in folder at given path for reading.
+ *
+ * - Looks up the file via the hash table of the folder's index (so a file
+ *   that does not exist is detected without scanning the folder) and opens
+ *   it via f_open() by its name on SD card.
+ * - Fills stamp with the file's FAT modification date (high word) and time
+ *   (low word), taken from the index, if known.
+ * - Does not use the singleton's folder.
+ */
+FRESULT dir_open_file(
+    FIL * const fil,
+    char const * const dir_path,
+    char const * const name,
+    uint32_t * const stamp);
+
 /**
  * - OK to be called, if already deinitialized (returns true).
  */
@@ -67,4 +143,30 @@ bool dir_reinit(char const * const dir_path);
 char* dir_create_full_path(
     char const * const dir_path, char const * const entry_name);
 
+/** Same as dir_create_full_path(), but given name may also be an alias of an
+ *  entry of the folder at given path (replaced by the entry's name).
+ *
+ * - Filesystem object must already have been mounted [f_mount()].
+ * - Does not use the singleton's folder.
+ */
+char* dir_create_full_path_of_alias(
+    char const * const dir_path, char const * const name);
+
+/** Set function to convert each character of an entry's name into the
+ *  character to use for its alias (letters must be upper case).
+ *
+ * - Defaults to converting letters to upper case, only.
+ * - Forgets indexes of all folders, if function differs.
+ */
+void dir_set_alias_char_func(char (*get_alias_char)(char const c));
+
+/** Set function to tell, if the entry with given name in folder at given path
+ *  is to be left out of folder indexes (e.g. a file used internally), or 0 to
+ *  index all entries.
+ *
+ * - Forgets indexes of all folders, if function differs.
+ */
+void dir_set_is_hidden_func(
+    bool (*is_hidden)(char const * const dir_path, char const * const name));
+
 #endif //MT_DIR
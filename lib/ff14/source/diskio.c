@@ -12,10 +12,98 @@
 #include "diskio.h"		/* Declarations of disk functions */
 
 #include "../../../hardware/sdcard/sdcard.h"
+#include "../../sectorcache/sectorcache.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 
 static bool s_is_initialized = false;
+static bool s_is_cached = false; // See disk_init_cache().
+
+static bool sd_read(
+    uint32_t const sector, uint32_t const count, uint8_t * const buf)
+{
+    return sdcard_blocks_transfer(
+            512 * (long long)sector, (int)count, (unsigned char *)buf, 0)
+        == SD_OK;
+}
+
+static bool sd_write(
+    uint32_t const sector, uint32_t const count, uint8_t const * const buf)
+{
+    return sdcard_blocks_transfer(
+            512 * (long long)sector, (int)count, (unsigned char *)buf, 1)
+        == SD_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Enable Sector Cache (before mounting)                                 */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_init_cache (
+	UINT sector_count,	/* Count of 512 byte sectors to cache */
+	UINT read_ahead		/* Sectors to read ahead on sequential reads */
+)
+{
+    struct sectorcache_params const p = {
+        .read = sd_read,
+        .write = sd_write,
+        .sector_count = (uint32_t)sector_count,
+        .read_ahead = (uint32_t)read_ahead
+    };
+
+    if(s_is_cached)
+    {
+        return RES_OK; // Already enabled.
+    }
+    if(!sectorcache_init(&p))
+    {
+        return RES_ERROR; // (works without cache)
+    }
+    s_is_cached = true;
+    return RES_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Read Sector(s), Bypassing Cache (medium change check, file loads)     */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_read_uncached (
+	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
+	BYTE *buff,		/* Data buffer to store read data */
+	LBA_t sector,	/* Start sector in LBA */
+	UINT count		/* Number of sectors to read */
+)
+{
+    (void)pdrv;
+
+	if(!s_is_initialized)
+    {
+        return RES_NOTRDY;
+    }
+    if(buff == 0/*NULL*/)
+    {
+        return RES_PARERR;
+    }
+    return sd_read((uint32_t)sector, (uint32_t)count, buff)
+        ? RES_OK : RES_ERROR;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Forget Cached Sectors (without writing back, e.g. on medium change)   */
+/*-----------------------------------------------------------------------*/
+
+void disk_invalidate_cache (
+	BYTE pdrv		/* Physical drive nmuber to identify the drive */
+)
+{
+    (void)pdrv;
+
+    if(s_is_cached)
+    {
+        sectorcache_invalidate();
+    }
+}
 
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
@@ -89,14 +177,13 @@ DRESULT disk_read (
         return RES_PARERR;
     }
 
-    long long const addr = 512 * (long long)sector;
-
-    if(sdcard_blocks_transfer(addr, (int)count, (unsigned char *)buff, 0)
-        != SD_OK)
+    if(s_is_cached)
     {
-        return RES_ERROR;
+        return sectorcache_read((uint32_t)sector, (uint32_t)count, buff)
+            ? RES_OK : RES_ERROR;
     }
-    return RES_OK;
+    return sd_read((uint32_t)sector, (uint32_t)count, buff)
+        ? RES_OK : RES_ERROR;
 }
 
 
@@ -129,14 +216,13 @@ DRESULT disk_write (
         return RES_PARERR;
     }
 
-    long long const addr = 512 * (long long)sector;
-
-    if(sdcard_blocks_transfer(addr, (int)count, (unsigned char *)buff, 1)
-        != SD_OK)
+    if(s_is_cached)
     {
-        return RES_ERROR;
+        return sectorcache_write((uint32_t)sector, (uint32_t)count, buff)
+            ? RES_OK : RES_ERROR;
     }
-    return RES_OK;
+    return sd_write((uint32_t)sector, (uint32_t)count, buff)
+        ? RES_OK : RES_ERROR;
 }
 
 #endif
@@ -163,5 +249,9 @@ DRESULT disk_ioctl (
     {
         return RES_ERROR;
     }
+    if(s_is_cached && !sectorcache_flush()) // (in ascending sector order)
+    {
+        return RES_ERROR;
+    }
     return RES_OK;
 }
@@ -32,6 +32,12 @@ DRESULT disk_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 
+/* Not used by FatFs (sector cache, see diskio.c) */
+
+DRESULT disk_init_cache (UINT sector_count, UINT read_ahead);
+DRESULT disk_read_uncached (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
+void disk_invalidate_cache (BYTE pdrv);
+
 
 /* Disk Status Bits (DSTATUS) */
 
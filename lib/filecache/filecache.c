@@ -0,0 +1,232 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "filecache.h"
+#include "../alloc/alloc.h"
+#include "../mem/mem.h"
+#include "../str/str.h"
+
+#ifndef NDEBUG
+    #include "../console/console.h"
+#endif //NDEBUG
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef MT_LINUX
+    #include <string.h>
+#endif //MT_LINUX
+
+struct entry
+{
+    char * key; // Full path in upper case.
+    uint32_t stamp;
+    uint8_t * bytes;
+    uint32_t byte_count;
+    bool is_pinned;
+
+    struct entry * next; // Less recently used entry or 0.
+};
+
+static struct entry * s_first = 0; // Most recently used entry.
+static uint32_t s_byte_count = 0; // Of all cached contents.
+static uint32_t s_max_byte_count = 0;
+
+static char * create_key(char const * const full_path)
+{
+    char * const ret_val = str_create_copy(full_path);
+
+    str_to_upper(ret_val, ret_val); // (FAT file names ignore letter case)
+    return ret_val;
+}
+
+static void free_entry(struct entry * const e)
+{
+    s_byte_count -= e->byte_count;
+    alloc_free(e->key);
+    alloc_free(e->bytes);
+    alloc_free(e);
+}
+
+/** Return pointer to pointer to entry with given key (or to last pointer of
+ *  list holding 0).
+ */
+static struct entry * * find(char const * const key)
+{
+    struct entry * * p = &s_first;
+
+    while(*p != 0 && !str_are_equal((*p)->key, key))
+    {
+        p = &((*p)->next);
+    }
+    return p;
+}
+
+/** Return copy of content of entry given via pointer to pointer to it and
+ *  make it the most recently used one.
+ */
+static uint8_t * create_copy(
+    struct entry * * const p, uint32_t * const out_byte_count)
+{
+    struct entry * const e = *p;
+    uint8_t * const ret_val = alloc_alloc(e->byte_count + 1);
+    //
+    // (+1 to support empty files, like filesys_load())
+
+    if(ret_val == 0)
+    {
+        return 0;
+    }
+    memcpy(ret_val, e->bytes, e->byte_count);
+    *out_byte_count = e->byte_count;
+
+    *p = e->next;
+    e->next = s_first;
+    s_first = e;
+
+#ifndef NDEBUG
+    console_write("filecache/create_copy : Cache hit for \"");
+    console_write(e->key);
+    console_writeline("\".");
+#endif //NDEBUG
+    return ret_val;
+}
+
+/** Remove least recently used entry not pinned from cache.
+ *
+ * - Returns false, if there is no such entry.
+ */
+static bool evict()
+{
+    struct entry * * p = &s_first,
+        * * last = 0;
+
+    while(*p != 0)
+    {
+        if(!(*p)->is_pinned)
+        {
+            last = p;
+        }
+        p = &((*p)->next);
+    }
+    if(last == 0)
+    {
+        return false;
+    }
+
+    struct entry * const e = *last;
+
+    *last = e->next;
+    free_entry(e);
+    return true;
+}
+
+void filecache_init(uint32_t const max_byte_count)
+{
+    filecache_clear();
+    s_max_byte_count = max_byte_count;
+}
+
+uint8_t * filecache_create_pinned_copy(
+    char const * const full_path, uint32_t * const out_byte_count)
+{
+    char * const key = create_key(full_path);
+    struct entry * * const p = find(key);
+
+    alloc_free(key);
+    if(*p == 0 || !(*p)->is_pinned)
+    {
+        return 0;
+    }
+    return create_copy(p, out_byte_count);
+}
+
+uint8_t * filecache_create_copy(
+    char const * const full_path,
+    uint32_t const byte_count,
+    uint32_t const stamp,
+    uint32_t * const out_byte_count)
+{
+    char * const key = create_key(full_path);
+    struct entry * * const p = find(key);
+
+    alloc_free(key);
+    if(*p == 0 || (*p)->byte_count != byte_count || (*p)->stamp != stamp)
+    {
+        return 0;
+    }
+    return create_copy(p, out_byte_count);
+}
+
+bool filecache_add(
+    char const * const full_path,
+    uint32_t const stamp,
+    uint8_t const * const bytes,
+    uint32_t const byte_count,
+    bool const is_pinned)
+{
+    filecache_remove(full_path);
+
+    if(byte_count > s_max_byte_count)
+    {
+        return false; // (also, if cache is disabled)
+    }
+    while(s_byte_count + byte_count > s_max_byte_count)
+    {
+        if(!evict())
+        {
+            return false; // Everything left is pinned.
+        }
+    }
+
+    struct entry * const e = alloc_alloc(sizeof *e);
+
+    if(e == 0)
+    {
+        return false;
+    }
+    e->bytes = alloc_alloc(byte_count + 1); // (+1 to support empty files)
+    if(e->bytes == 0)
+    {
+        alloc_free(e);
+        return false;
+    }
+    memcpy(e->bytes, bytes, byte_count);
+    e->key = create_key(full_path);
+    e->stamp = stamp;
+    e->byte_count = byte_count;
+    e->is_pinned = is_pinned;
+
+    e->next = s_first;
+    s_first = e;
+    s_byte_count += byte_count;
+    return true;
+}
+
+void filecache_remove(char const * const full_path)
+{
+    char * const key = create_key(full_path);
+    struct entry * * const p = find(key);
+
+    alloc_free(key);
+    if(*p == 0)
+    {
+        return;
+    }
+
+    struct entry * const e = *p;
+
+    *p = e->next;
+    free_entry(e);
+}
+
+void filecache_clear()
+{
+    while(s_first != 0)
+    {
+        struct entry * const e = s_first;
+
+        s_first = e->next;
+        free_entry(e);
+    }
+}
@@ -0,0 +1,65 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Singleton (!) LRU cache of file contents in RAM, keyed by full path (letter
+// case ignored), size and time stamp.
+//
+// - Pinned files are never evicted and are served without checking size and
+//   time stamp, so they must be removed from cache on each change [see
+//   filecache_remove()].
+
+#ifndef MT_FILECACHE
+#define MT_FILECACHE
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Set count of bytes of file contents that may be cached.
+ *
+ * - Zero disables the cache.
+ */
+void filecache_init(uint32_t const max_byte_count);
+
+/** Return copy of content of file at given full path, if it is pinned.
+ *
+ * - Caller takes ownership of return value.
+ * - Returns 0, if file is not cached or not pinned.
+ */
+uint8_t * filecache_create_pinned_copy(
+    char const * const full_path, uint32_t * const out_byte_count);
+
+/** Return copy of content of file at given full path, if it is cached with
+ *  given size and time stamp.
+ *
+ * - Caller takes ownership of return value.
+ * - Returns 0, if file is not cached (with given size and time stamp).
+ */
+uint8_t * filecache_create_copy(
+    char const * const full_path,
+    uint32_t const byte_count,
+    uint32_t const stamp,
+    uint32_t * const out_byte_count);
+
+/** Cache copy of given content of file at given full path.
+ *
+ * - Replaces cached content of same file, if any.
+ * - Evicts least recently used files not pinned, if necessary.
+ * - Returns false, if not cached (e.g. too large).
+ */
+bool filecache_add(
+    char const * const full_path,
+    uint32_t const stamp,
+    uint8_t const * const bytes,
+    uint32_t const byte_count,
+    bool const is_pinned);
+
+/** Remove file at given full path from cache (if cached, at all).
+ */
+void filecache_remove(char const * const full_path);
+
+/** Remove all files from cache, pinned ones, too (e.g. after the SD card got
+ *  changed).
+ */
+void filecache_clear();
+
+#endif //MT_FILECACHE
@@ -4,9 +4,11 @@
 #include "filesys.h"
 #include "../alloc/alloc.h"
 #include "../ff14/source/ff.h"
+#include "../ff14/source/diskio.h"
 #include "../assert.h"
 #include "../dir/dir.h"
-#include "../ff14/source/ff.h"
+#include "../str/str.h"
+#include "../filecache/filecache.h"
 
 #ifndef NDEBUG
     #include "../../lib/console/console.h"
@@ -15,7 +17,97 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Files at least this large are read sector-wise straight from the SD card
+// into the (aligned) destination buffer [see read_direct()]:
+//
+#define MT_FILESYS_DIRECT_MIN_LEN (8 * 1024)
+
+// Alignment of buffers holding loaded files (one sector, which is more than
+// needed by the SD card driver to avoid its byte-wise copying):
+//
+#define MT_FILESYS_BUF_ALIGN FF_MAX_SS
+
+// Max. count of sectors to be read at once (limited by SD card block count
+// register's 16 bits):
+//
+#define MT_FILESYS_MAX_SECTORS_PER_READ 0xFFFF
+
 static FATFS * s_fs = 0;
+static uint32_t s_serial = 0; // Volume serial nr. of mounted file system.
+
+// Saves queued to be written by filesys_flush():
+//
+struct queued_save
+{
+    char * full_path;
+    char * key; // Full path in upper case.
+    uint8_t * bytes;
+    uint32_t byte_count;
+
+    struct queued_save * next; // Later queued save or 0.
+};
+static struct queued_save * s_queue = 0; // Earliest queued save.
+
+// Set by filesys_init_journal(), queued saves are written directly, if 0:
+//
+static char * s_tmp_path = 0;
+static char * s_journal_path = 0;
+
+// Set by filesys_pin(), to pin files of a new SD card again after a change
+// got detected [see filesys_mount()]:
+//
+static char * s_pin_dir_path = 0;
+static char * s_pin_list_filename = 0;
+static bool s_is_pin_pending = false;
+
+// Set by filesys_set_on_change():
+//
+static void (*s_on_change)(char const * const full_path) = 0;
+static void (*s_on_saved)(
+    char const * const full_path, uint32_t const byte_count) = 0;
+
+static void notify_change(char const * const full_path)
+{
+    if(s_on_change != 0)
+    {
+        s_on_change(full_path);
+    }
+}
+
+/** Update indexes with given file that got saved with given size.
+ */
+static void set_saved(char const * const full_path, uint32_t const byte_count)
+{
+    dir_index_set(full_path, false, byte_count);
+    if(s_on_saved != 0)
+    {
+        s_on_saved(full_path, byte_count);
+    }
+}
+
+/** Read volume serial number from boot sector of mounted file system.
+ *
+ * - Does not use (and does not invalidate) sector window of file system and
+ *   bypasses sector cache (see diskio.c).
+ */
+static bool read_serial(uint32_t * const serial)
+{
+    BYTE buf[FF_MAX_SS];
+    int const offset = s_fs->fs_type == FS_FAT32
+        ? 67 // BS_VolID32
+        : 39; // BS_VolID
+
+    if(disk_read_uncached(s_fs->pdrv, buf, s_fs->volbase, 1) != RES_OK)
+    {
+        return false;
+    }
+
+    *serial = (uint32_t)buf[offset]
+        | ((uint32_t)buf[offset + 1] << 8)
+        | ((uint32_t)buf[offset + 2] << 16)
+        | ((uint32_t)buf[offset + 3] << 24);
+    return true;
+}
 
 /**
  * - Also returns false, if s_fs is not 0.
@@ -33,8 +125,10 @@ static bool mount()
         return false;
     }
 
-    if(f_mount(s_fs, "", 1) != FR_OK) // (forces mount)
+    if(f_mount(s_fs, "", 1) != FR_OK // (forces mount)
+        || !read_serial(&s_serial))
     {
+        f_mount(0, "", 0);
         alloc_free(s_fs);
         s_fs = 0;
         return false;
@@ -50,6 +144,9 @@ bool filesys_unmount()
         return true;
     }
 
+    notify_change(0); // (open files refer to file system object)
+    dir_index_clear(); // (indexes refer to file system object)
+
     if(f_mount(0, "", 0) != FR_OK)
     {
         return false;
@@ -62,6 +159,8 @@ bool filesys_unmount()
 
 bool filesys_remount()
 {
+    dir_index_clear(); // (folders may have changed)
+
     if(s_fs != 0)
     {
         if(!filesys_unmount())
@@ -72,22 +171,202 @@ bool filesys_remount()
     return mount();
 }
 
-uint8_t* filesys_load(
+bool filesys_mount()
+{
+    uint32_t serial = 0;
+
+    if(s_fs == 0)
+    {
+        return mount();
+    }
+    if(read_serial(&serial) && serial == s_serial)
+    {
+        return true; // Still the same card.
+    }
+
+#ifndef NDEBUG
+    console_writeline("filesys_mount : SD card changed, remounting..");
+#endif //NDEBUG
+    disk_invalidate_cache(s_fs->pdrv);
+    filecache_clear(); // (pinned files are gone with the card, too)
+    s_is_pin_pending = s_pin_dir_path != 0; // (by next load, see load())
+    return filesys_remount();
+}
+
+DWORD * filesys_create_clmt(FIL * const fil)
+{
+    DWORD len = 32; // Enough for a file with up to 15 fragments.
+
+    while(true)
+    {
+        DWORD * const ret_val = alloc_alloc(len * sizeof *ret_val);
+
+        if(ret_val == 0)
+        {
+            return 0;
+        }
+        ret_val[0] = len;
+        fil->cltbl = ret_val;
+
+        FRESULT const r = f_lseek(fil, CREATE_LINKMAP);
+
+        fil->cltbl = 0;
+        if(r == FR_OK)
+        {
+            return ret_val;
+        }
+        len = ret_val[0]; // (holds required size, if not enough core)
+        alloc_free(ret_val);
+        if(r != FR_NOT_ENOUGH_CORE)
+        {
+            return 0;
+        }
+    }
+}
+
+/** Read given count of bytes of given file opened for reading (at position
+ *  zero) into given buffer, merging each run of contiguous clusters into as
+ *  few multi-sector reads as possible and bypassing the sector cache.
+ *
+ * - Only the whole sectors are read directly, the rest via FatFs.
+ * - Returns false on error, then the file's position is undefined.
+ */
+static bool read_direct(
+    FIL * const fil, uint8_t * const bytes, uint32_t const count)
+{
+    FATFS * const fs = fil->obj.fs;
+    DWORD * const clmt = filesys_create_clmt(fil);
+    uint32_t const sector_count = count / FF_MAX_SS;
+    uint32_t done = 0; // Count of sectors read.
+    DWORD const * run = clmt + 1;
+    UINT read_len = 0;
+
+    if(clmt == 0)
+    {
+        return false;
+    }
+
+    // Makes sure, that no sector of file is waiting in sector cache:
+    //
+    if(disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK)
+    {
+        alloc_free(clmt);
+        return false;
+    }
+
+    while(done < sector_count && run[0] != 0)
+    {
+        uint32_t const run_sectors = (uint32_t)run[0] * fs->csize;
+        LBA_t sector = fs->database + (LBA_t)(run[1] - 2) * fs->csize;
+        uint32_t left = sector_count - done;
+
+        if(left > run_sectors)
+        {
+            left = run_sectors;
+        }
+        while(left > 0)
+        {
+            UINT const n = left > MT_FILESYS_MAX_SECTORS_PER_READ
+                ? MT_FILESYS_MAX_SECTORS_PER_READ
+                : (UINT)left;
+
+            if(disk_read_uncached(
+                    fs->pdrv, bytes + done * FF_MAX_SS, sector, n) != RES_OK)
+            {
+                alloc_free(clmt);
+                return false;
+            }
+            sector += n;
+            done += n;
+            left -= n;
+        }
+        run += 2;
+    }
+    if(done < sector_count)
+    {
+        alloc_free(clmt);
+        return false; // (table does not match file size)
+    }
+
+    if(done * FF_MAX_SS < count)
+    {
+        fil->cltbl = clmt; // (seeks without following the FAT)
+        if(f_lseek(fil, (FSIZE_t)done * FF_MAX_SS) != FR_OK
+            || f_read(
+                    fil,
+                    bytes + done * FF_MAX_SS,
+                    (UINT)(count - done * FF_MAX_SS),
+                    &read_len) != FR_OK
+            || (uint32_t)read_len != count - done * FF_MAX_SS)
+        {
+            fil->cltbl = 0;
+            alloc_free(clmt);
+            return false;
+        }
+        fil->cltbl = 0;
+    }
+    alloc_free(clmt);
+    return true;
+}
+
+/** Load full file content (and cache it), like filesys_load().
+ *
+ * - Pins file in cache, if pin is true.
+ */
+static uint8_t* load(
     char const * const dir_path,
     char const * const filename,
-    uint32_t * const out_byte_count)
+    uint32_t * const out_byte_count,
+    bool const pin)
 {
     assert(out_byte_count != 0);
 
     FIL fil;
     UINT read_len = 0;
+    uint32_t stamp = 0;
+    uint8_t * bytes = 0;
+
+    if(!pin)
+    {
+        // Pinned files are served without any SD card access (a queued save
+        // to a pinned file removes it from cache):
+
+        char * const pinned_path = dir_create_full_path(dir_path, filename);
+
+        bytes = filecache_create_pinned_copy(pinned_path, out_byte_count);
+        alloc_free(pinned_path);
+        if(bytes != 0)
+        {
+            return bytes;
+        }
+    }
 
-    filesys_remount();
+    filesys_flush(); // (file to load may be queued to be saved)
+    filesys_mount();
+    if(s_is_pin_pending && !pin)
+    {
+        s_is_pin_pending = false;
+        filesys_pin(s_pin_dir_path, s_pin_list_filename); // (SD card changed)
+    }
     dir_reinit(dir_path);
 
-    char * const full_path = dir_create_full_path(dir_path, filename);
+    // Given file name may be an alias (cache uses names on SD card):
+    //
+    char * const full_path = dir_create_full_path_of_alias(
+        dir_path, filename);
+
+    if(!pin)
+    {
+        bytes = filecache_create_pinned_copy(full_path, out_byte_count);
+        if(bytes != 0)
+        {
+            alloc_free(full_path);
+            dir_deinit();
+            return bytes; // Without opening file (e.g. given an alias).
+        }
+    }
 
-    if(f_open(&fil, full_path, FA_READ) != FR_OK)
+    if(dir_open_file(&fil, dir_path, filename, &stamp) != FR_OK)
     {
 #ifndef NDEBUG
         console_write("filesys_load : Error: Opening file \"");
@@ -96,18 +375,47 @@ uint8_t* filesys_load(
 #endif //NDEBUG
         alloc_free(full_path);
         dir_deinit();
-        filesys_unmount();
         *out_byte_count = 0;
         return 0;
     }
 
     uint32_t const count = (uint32_t)f_size(&fil);
 
-    uint8_t * const bytes = alloc_alloc(count * sizeof *bytes + 1);
+    if(!pin)
+    {
+        bytes = filecache_create_copy(full_path, count, stamp, out_byte_count);
+        if(bytes != 0)
+        {
+            f_close(&fil);
+            alloc_free(full_path);
+            dir_deinit();
+            return bytes;
+        }
+    }
+
+    bytes = alloc_alloc_aligned(
+        count * sizeof *bytes + 1, MT_FILESYS_BUF_ALIGN);
     //
     // (+1 to support empty files)
 
-    f_read(&fil, bytes, (UINT)count, &read_len);
+    if(bytes == 0)
+    {
+        f_close(&fil);
+        alloc_free(full_path);
+        dir_deinit();
+        *out_byte_count = 0;
+        return 0;
+    }
+
+    if(count >= MT_FILESYS_DIRECT_MIN_LEN && read_direct(&fil, bytes, count))
+    {
+        read_len = (UINT)count;
+    }
+    else
+    {
+        f_lseek(&fil, 0); // (in case direct reading failed)
+        f_read(&fil, bytes, (UINT)count, &read_len);
+    }
 
 #ifndef NDEBUG
     assert(count == read_len);
@@ -118,50 +426,105 @@ uint8_t* filesys_load(
 #endif
 
     f_close(&fil);
+
+    if((uint32_t)read_len == count)
+    {
+        filecache_add(full_path, stamp, bytes, count, pin);
+    }
+
     alloc_free(full_path);
     dir_deinit();
-    filesys_unmount();
 
     *out_byte_count = read_len;
     return bytes;
 }
 
-bool filesys_save(
+uint8_t* filesys_load(
     char const * const dir_path,
     char const * const filename,
-    uint8_t const * const bytes,
-    uint32_t const byte_count,
-    bool const overwrite)
+    uint32_t * const out_byte_count)
 {
-    bool ret_val = false,
-        file_is_open = false;
-    FIL fil;
+    return load(dir_path, filename, out_byte_count, false);
+}
 
-    filesys_remount();
-    dir_reinit(dir_path);
+uint32_t filesys_pin(
+    char const * const dir_path, char const * const list_filename)
+{
+    uint32_t ret_val = 0, count = 0, beg = 0;
+
+    if(s_pin_dir_path != dir_path) // (not called again by load())
+    {
+        alloc_free(s_pin_dir_path);
+        alloc_free(s_pin_list_filename);
+        s_pin_dir_path = str_create_copy(dir_path);
+        s_pin_list_filename = str_create_copy(list_filename);
+    }
 
-    char * const full_path = dir_create_full_path(dir_path, filename);
+    uint8_t * const list = filesys_load(dir_path, list_filename, &count);
 
-    do
+    if(list == 0)
     {
-        UINT write_count;
-        BYTE mode = FA_WRITE;
+        return 0;
+    }
 
-        if(overwrite)
+    for(uint32_t i = 0;i <= count;++i)
+    {
+        if(i < count && list[i] != '\r' && list[i] != '\n')
         {
-            mode |= FA_CREATE_ALWAYS;
+            continue;
         }
-        else
+        if(i > beg) // (otherwise ignores empty line)
         {
-            mode |= FA_CREATE_NEW;
+            char * const path = str_create_partial_copy(
+                (char const *)list, beg, i - beg);
+            int const slash = str_get_last_index(path, '/');
+            char * const dir = slash == -1
+                ? str_create_copy(dir_path) // (relative to list's folder)
+                : (slash == 0
+                    ? str_create_copy("/")
+                    : str_create_partial_copy(path, 0, (uint32_t)slash));
+            uint32_t file_count = 0;
+            uint8_t * const bytes = load(
+                dir, path + slash + 1, &file_count, true);
+
+            if(bytes != 0)
+            {
+                alloc_free(bytes);
+                ++ret_val;
+            }
+            alloc_free(dir);
+            alloc_free(path);
         }
+        beg = i + 1;
+    }
+    alloc_free(list);
 
-        FRESULT const open_result = f_open(&fil, full_path, mode);
+#ifndef NDEBUG
+    console_write("filesys_pin : Loaded ");
+    console_write_dword_dec(ret_val);
+    console_writeline(" file(-s) to be pinned in cache.");
+#endif //NDEBUG
+    return ret_val;
+}
 
-        if(open_result != FR_OK)
-        {
+/** Write given bytes to file at given full path, opened with given mode.
+ *
+ * - Removes the file again, if writing fails.
+ */
+static bool write_file(
+    char const * const full_path,
+    uint8_t const * const bytes,
+    uint32_t const byte_count,
+    BYTE const mode)
+{
+    FIL fil;
+    UINT write_count = 0;
+    FRESULT const open_result = f_open(&fil, full_path, mode);
+
+    if(open_result != FR_OK)
+    {
 #ifndef NDEBUG
-        console_write("filesys_save : Error: Opening file \"");
+        console_write("filesys/write_file : Error: Opening file \"");
         console_write(full_path);
         console_write("\" with mode 0x");
         console_write_byte((uint8_t)mode);
@@ -169,34 +532,318 @@ bool filesys_save(
         console_write_dword_dec((uint32_t)open_result);
         console_writeline("!");
 #endif //NDEBUG
-            break;
-        }
-        file_is_open = true;
+        return false;
+    }
+
+    bool const ret_val =
+        f_write(&fil, bytes, byte_count, &write_count) == FR_OK
+            && write_count == byte_count;
+
+    if(f_close(&fil) != FR_OK || !ret_val)
+    {
+        f_unlink(full_path);
+        return false;
+    }
+    return true;
+}
+
+static char get_upper(char const c)
+{
+    return 'a' <= c && c <= 'z' ? (char)(c - ('a' - 'A')) : c;
+}
+
+/** Return true, if given full path is the one of the entry with given name in
+ *  folder at given path (letter case ignored).
+ */
+static bool is_path_of(
+    char const * const full_path,
+    char const * const dir_path,
+    char const * const name)
+{
+    int const slash = str_get_last_index(full_path, '/');
+    uint32_t const dir_len = slash == 0 ? 1 : (uint32_t)slash;
+    char const * const full_name = full_path + slash + 1;
+    uint32_t i = 0;
 
-        if(f_write(&fil, bytes, byte_count, &write_count) != FR_OK)
+    while(full_name[i] != '\0'
+        && get_upper(full_name[i]) == get_upper(name[i]))
+    {
+        ++i;
+    }
+    if(full_name[i] != name[i] || str_get_len(dir_path) != dir_len)
+    {
+        return false;
+    }
+    for(i = 0;i < dir_len;++i)
+    {
+        if(get_upper(full_path[i]) != get_upper(dir_path[i]))
         {
-            break;
+            return false;
         }
-        if(write_count != byte_count)
+    }
+    return true;
+}
+
+bool filesys_is_journal_file(
+    char const * const dir_path, char const * const name)
+{
+    return s_tmp_path != 0
+        && (is_path_of(s_tmp_path, dir_path, name)
+            || is_path_of(s_journal_path, dir_path, name));
+}
+
+/** Replace file at given full path with temporary file and remove journal.
+ *
+ * - Last step of committing a queued save [see write_queued()], also used to
+ *   complete an interrupted commit.
+ */
+static bool commit(char const * const full_path)
+{
+    FRESULT const r = f_unlink(full_path);
+    bool const ret_val = (r == FR_OK || r == FR_NO_FILE)
+        && f_rename(s_tmp_path, full_path) == FR_OK;
+
+    f_unlink(s_journal_path);
+    return ret_val;
+}
+
+/** Write queued save to SD card.
+ *
+ * - With journal set [see filesys_init_journal()] the content is written to
+ *   the temporary file, then the journal is written (holding the full path)
+ *   and then the temporary file gets renamed. So a power cut leaves either
+ *   the old file or the new one (after recovery).
+ */
+static bool write_queued(struct queued_save const * const q)
+{
+    BYTE const mode = FA_CREATE_ALWAYS | FA_WRITE;
+
+    if(s_tmp_path == 0)
+    {
+        return write_file(q->full_path, q->bytes, q->byte_count, mode);
+    }
+
+    if(!write_file(s_tmp_path, q->bytes, q->byte_count, mode))
+    {
+        return false;
+    }
+    if(!write_file(
+            s_journal_path,
+            (uint8_t const *)q->full_path,
+            str_get_len(q->full_path),
+            mode))
+    {
+        f_unlink(s_tmp_path);
+        return false;
+    }
+    return commit(q->full_path);
+}
+
+static void free_queued(struct queued_save * const q)
+{
+    alloc_free(q->full_path);
+    alloc_free(q->key);
+    alloc_free(q->bytes);
+    alloc_free(q);
+}
+
+/** Return true, if a save to given full path is queued.
+ */
+static bool is_queued(char const * const full_path)
+{
+    bool ret_val = false;
+    char * const key = str_create_copy(full_path);
+
+    str_to_upper(key, key); // (FAT file names ignore letter case)
+    for(struct queued_save const * q = s_queue;q != 0;q = q->next)
+    {
+        if(str_are_equal(q->key, key))
         {
+            ret_val = true;
             break;
         }
+    }
+    alloc_free(key);
+    return ret_val;
+}
+
+void filesys_set_on_change(
+    void (*on_change)(char const * const full_path),
+    void (*on_saved)(char const * const full_path, uint32_t const byte_count))
+{
+    s_on_change = on_change;
+    s_on_saved = on_saved;
+}
+
+void filesys_init_journal(
+    char const * const dir_path,
+    char const * const tmp_filename,
+    char const * const journal_filename)
+{
+    FIL fil;
+    UINT read_len = 0;
+
+    alloc_free(s_tmp_path);
+    alloc_free(s_journal_path);
+    s_tmp_path = dir_create_full_path(dir_path, tmp_filename);
+    s_journal_path = dir_create_full_path(dir_path, journal_filename);
+    dir_set_is_hidden_func(filesys_is_journal_file); // (not to be listed)
+
+    if(!filesys_mount())
+    {
+        return;
+    }
+
+    if(f_open(&fil, s_journal_path, FA_READ) != FR_OK)
+    {
+        f_unlink(s_tmp_path); // (content of a save not committed, if any)
+        return;
+    }
 
-        ret_val = true;
-    }while(false);
+    // Journal exists, complete commit:
 
-    if(file_is_open)
+    uint32_t const count = (uint32_t)f_size(&fil);
+    char * const full_path = alloc_alloc(count + 1);
+
+    if(full_path == 0)
     {
         f_close(&fil);
-        file_is_open = false;
+        return;
+    }
+    f_read(&fil, full_path, (UINT)count, &read_len);
+    f_close(&fil);
+    full_path[read_len] = '\0';
+
+    if(f_stat(s_tmp_path, 0) == FR_OK)
+    {
+#ifndef NDEBUG
+        console_write("filesys_init_journal : Completing save of \"");
+        console_write(full_path);
+        console_writeline("\"..");
+#endif //NDEBUG
+        commit(full_path);
+    }
+    else
+    {
+        f_unlink(s_journal_path); // (renamed, already)
+    }
+    alloc_free(full_path);
+}
+
+bool filesys_save_queued(
+    char const * const dir_path,
+    char const * const filename,
+    uint8_t * const bytes,
+    uint32_t const byte_count,
+    bool const overwrite)
+{
+    filesys_mount();
+    dir_reinit(dir_path);
+
+    char * const full_path = dir_create_full_path_of_alias(
+        dir_path, filename); // (overwrites file given by alias)
+    struct queued_save * const q = alloc_alloc(sizeof *q);
+
+    if(q == 0
+        || dir_has_sub_dir(filename)
+        || (!overwrite && (dir_is_file(filename) || is_queued(full_path))))
+    {
+        alloc_free(q);
+        alloc_free(full_path);
+        alloc_free(bytes);
+        dir_deinit();
+        return false;
+    }
+    dir_deinit();
+
+    filecache_remove(full_path); // (whether saving succeeds, or not)
+
+    q->full_path = full_path;
+    q->key = str_create_copy(full_path);
+    str_to_upper(q->key, q->key);
+    q->bytes = bytes;
+    q->byte_count = byte_count;
+    q->next = 0;
+
+    struct queued_save * * p = &s_queue;
+
+    while(*p != 0)
+    {
+        p = &((*p)->next);
+    }
+    *p = q;
+    return true;
+}
+
+bool filesys_flush()
+{
+    bool ret_val = true;
+
+    if(s_queue == 0)
+    {
+        return true;
+    }
 
-        if(!ret_val)
+    filesys_mount();
+
+    while(s_queue != 0)
+    {
+        struct queued_save * const q = s_queue;
+
+        s_queue = q->next;
+
+        notify_change(q->full_path);
+        if(write_queued(q))
         {
-            f_unlink(filename);
+            set_saved(q->full_path, q->byte_count);
+        }
+        else
+        {
+#ifndef NDEBUG
+            console_write("filesys_flush : Error: Saving \"");
+            console_write(q->full_path);
+            console_writeline("\" failed!");
+#endif //NDEBUG
+            dir_index_clear(); // (file may or may not exist)
+            ret_val = false;
         }
+        free_queued(q);
+    }
+    return ret_val;
+}
+
+bool filesys_save(
+    char const * const dir_path,
+    char const * const filename,
+    uint8_t const * const bytes,
+    uint32_t const byte_count,
+    bool const overwrite)
+{
+    filesys_flush(); // (keeps order of saves)
+    filesys_mount();
+    dir_reinit(dir_path);
+
+    char * const full_path = dir_create_full_path_of_alias(
+        dir_path, filename); // (overwrites file given by alias)
+
+    filecache_remove(full_path); // (whether saving succeeds, or not)
+    notify_change(full_path);
+
+    bool const ret_val = write_file(
+        full_path,
+        bytes,
+        byte_count,
+        (overwrite ? FA_CREATE_ALWAYS : FA_CREATE_NEW) | FA_WRITE);
+
+    if(ret_val)
+    {
+        set_saved(full_path, byte_count);
+    }
+    else
+    {
+        dir_index_clear(); // (file may or may not exist)
     }
     alloc_free(full_path);
     dir_deinit();
-    filesys_unmount();
     return ret_val;
 }
@@ -2,10 +2,17 @@
 // Marcel Timm, RhinoDevel, 2019dec03
 
 // Singleton for SINGLE file system mount and unmount.
+//
+// - The file system stays mounted between operations [see filesys_mount()],
+//   so FatFs keeps its sector window (e.g. of FAT or a directory) cached.
+// - FatFs writes all changes back on closing a file, removing an entry, etc.,
+//   so there is no need to unmount before e.g. a power cut.
 
 #ifndef MT_FILESYS
 #define MT_FILESYS
 
+#include "../ff14/source/ff.h"
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -14,11 +21,34 @@
  */
 bool filesys_unmount();
 
+/** Force (re-)mount.
+ */
 bool filesys_remount();
 
+/** Mount file system, if not mounted, yet.
+ *
+ * - Keeps existing mount, unless the SD card got changed (detected via volume
+ *   serial number in boot sector, which is read without touching the sector
+ *   window of FatFs) or can not be read, then remounts.
+ */
+bool filesys_mount();
+
+/** Create cluster link map table for FatFs fast seek of given file opened for
+ *  reading (holds file's runs of contiguous clusters).
+ *
+ * - Does NOT set the file's table.
+ * - Caller takes ownership of returned object.
+ * - Returns 0 on error.
+ */
+DWORD * filesys_create_clmt(FIL * const fil);
+
 /** Load full file content and set byte count.
  * 
  *  - Supports empty files.
+ *  - Served from file cache, if cached and unchanged [see filecache.h],
+ *    pinned files are served without accessing the SD card, at all.
+ *  - Returned buffer is sector-aligned and larger files are read directly
+ *    into it with one multi-sector read per run of contiguous clusters.
  *  - Caller takes ownership of returned object.
  *  - Returns 0 on error.
  */
@@ -27,6 +57,77 @@ uint8_t* filesys_load(
     char const * const filename,
     uint32_t * const out_byte_count);
 
+/** Load files listed in given file (one path per line, relative to given
+ *  folder, if not starting with '/') to be kept in file cache [see
+ *  filecache.h], so they are served without accessing the SD card.
+ *
+ * - Pins the files listed on the new card again by the next load after an SD
+ *   card change got detected [see filesys_mount()].
+ * - Returns count of files loaded.
+ */
+uint32_t filesys_pin(
+    char const * const dir_path, char const * const list_filename);
+
+/** Set functions to be called on changes of files (or 0 to not call a
+ *  function):
+ *
+ * - on_change() gets full path of a file right before it gets written by a
+ *   save, or 0 before the file system gets unmounted (e.g. on SD card
+ *   change). E.g. to close a file held open for reading and to drop its
+ *   cached content.
+ * - on_saved() gets full path and size of a file after it got saved (e.g. to
+ *   update an index). Must not save or load files itself.
+ */
+void filesys_set_on_change(
+    void (*on_change)(char const * const full_path),
+    void (*on_saved)(char const * const full_path, uint32_t const byte_count));
+
+/** Set folder and names of files used to commit queued saves [see
+ *  filesys_save_queued()] safely and complete a commit interrupted by e.g. a
+ *  power cut (or remove content of a save not committed).
+ *
+ * - To be called once at startup, before any save got queued.
+ * - Without this, queued saves are written directly to their files.
+ */
+void filesys_init_journal(
+    char const * const dir_path,
+    char const * const tmp_filename,
+    char const * const journal_filename);
+
+/** Return true, if the entry with given name in folder at given path is the
+ *  temporary file or the journal set by filesys_init_journal().
+ *
+ * - These are left out of folder indexes [see dir_set_is_hidden_func()].
+ */
+bool filesys_is_journal_file(
+    char const * const dir_path, char const * const name);
+
+/** Queue save of given bytes to file with given name in given directory, to
+ *  be written later by filesys_flush() (e.g. after the Commodore machine got
+ *  acknowledged).
+ *
+ *  - Takes ownership of given bytes (also on failure).
+ *  - Checks for an existing file (or a queued save to it), if overwrite is
+ *    false, and for a folder with given name. Errors while writing are
+ *    reported by filesys_flush(), only.
+ *  - Returns, if queued or not.
+ */
+bool filesys_save_queued(
+    char const * const dir_path,
+    char const * const filename,
+    uint8_t * const bytes,
+    uint32_t const byte_count,
+    bool const overwrite);
+
+/** Write all queued saves to SD card, each with one call of FatFs' f_write()
+ *  (which writes whole sectors directly).
+ *
+ *  - Called by filesys_load() and filesys_save(), so these never miss a
+ *    queued save.
+ *  - Returns false, if at least one save failed (it is dropped, then).
+ */
+bool filesys_flush();
+
 /** Saves given count of bytes starting at given pointer at given directory with
  *  given file name.
  * 
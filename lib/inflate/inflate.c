@@ -0,0 +1,415 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "inflate.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MT_INFLATE_MAX_BITS 15 // Of a Huffman code.
+#define MT_INFLATE_LIT_COUNT 288 // Literal/length symbols.
+#define MT_INFLATE_DIST_COUNT 32 // Distance symbols.
+#define MT_INFLATE_CLEN_COUNT 19 // Code length symbols.
+
+// Canonical Huffman code, given by count of codes per length and symbols
+// ordered by code:
+//
+struct tree
+{
+    uint16_t counts[MT_INFLATE_MAX_BITS + 1];
+    uint16_t symbols[MT_INFLATE_LIT_COUNT];
+};
+
+struct state
+{
+    uint8_t const * src;
+    uint32_t src_len;
+    uint32_t src_pos;
+    uint32_t bits; // Not consumed, yet (LSB first).
+    int bit_count;
+
+    uint8_t * dest;
+    uint32_t dest_len;
+    uint32_t dest_pos;
+
+    bool is_err; // Set on invalid input (then reads return zeros).
+};
+
+static uint16_t const s_len_base[] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static uint8_t const s_len_extra[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static uint16_t const s_dist_base[] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577 };
+static uint8_t const s_dist_extra[] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static uint8_t const s_clen_order[MT_INFLATE_CLEN_COUNT] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+static uint32_t get_bits(struct state * const s, int const count)
+{
+    while(s->bit_count < count)
+    {
+        if(s->src_pos == s->src_len)
+        {
+            s->is_err = true;
+            return 0;
+        }
+        s->bits |= (uint32_t)s->src[s->src_pos] << s->bit_count;
+        ++s->src_pos;
+        s->bit_count += 8;
+    }
+
+    uint32_t const ret_val = s->bits & ((1UL << count) - 1);
+
+    s->bits >>= count;
+    s->bit_count -= count;
+    return ret_val;
+}
+
+/** Build code from given code lengths of given count of symbols.
+ *
+ * - Returns false, if code is over-subscribed.
+ */
+static bool build_tree(
+    struct tree * const t, uint8_t const * const lens, int const count)
+{
+    uint16_t offsets[MT_INFLATE_MAX_BITS + 1];
+    int left = 1;
+
+    for(int i = 0;i <= MT_INFLATE_MAX_BITS;++i)
+    {
+        t->counts[i] = 0;
+    }
+    for(int i = 0;i < count;++i)
+    {
+        ++t->counts[lens[i]];
+    }
+    t->counts[0] = 0;
+
+    for(int i = 1;i <= MT_INFLATE_MAX_BITS;++i)
+    {
+        left = 2 * left - t->counts[i];
+        if(left < 0)
+        {
+            return false;
+        }
+    }
+
+    offsets[1] = 0;
+    for(int i = 1;i < MT_INFLATE_MAX_BITS;++i)
+    {
+        offsets[i + 1] = offsets[i] + t->counts[i];
+    }
+    for(int i = 0;i < count;++i)
+    {
+        if(lens[i] != 0)
+        {
+            t->symbols[offsets[lens[i]]] = (uint16_t)i;
+            ++offsets[lens[i]];
+        }
+    }
+    return true;
+}
+
+/** Decode next symbol via given code (bit by bit, codes are stored starting
+ *  with their most significant bit).
+ *
+ * - Returns -1 on error.
+ */
+static int decode(struct state * const s, struct tree const * const t)
+{
+    int code = 0, first = 0, index = 0;
+
+    for(int len = 1;len <= MT_INFLATE_MAX_BITS;++len)
+    {
+        code |= (int)get_bits(s, 1);
+        if(s->is_err)
+        {
+            return -1;
+        }
+
+        int const count = t->counts[len];
+
+        if(code - first < count)
+        {
+            return t->symbols[index + code - first];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1; // (incomplete code)
+}
+
+static bool inflate_stored(struct state * const s)
+{
+    // Skip to byte boundary (bits left are less than a byte after that):
+    //
+    s->bits = 0;
+    s->bit_count = 0;
+
+    if(s->src_len - s->src_pos < 4)
+    {
+        return false;
+    }
+
+    uint32_t const len = (uint32_t)s->src[s->src_pos]
+            | ((uint32_t)s->src[s->src_pos + 1] << 8),
+        nlen = (uint32_t)s->src[s->src_pos + 2]
+            | ((uint32_t)s->src[s->src_pos + 3] << 8);
+
+    s->src_pos += 4;
+    if(len != (~nlen & 0xFFFF)
+        || s->src_len - s->src_pos < len
+        || s->dest_len - s->dest_pos < len)
+    {
+        return false;
+    }
+    for(uint32_t i = 0;i < len;++i)
+    {
+        s->dest[s->dest_pos + i] = s->src[s->src_pos + i];
+    }
+    s->src_pos += len;
+    s->dest_pos += len;
+    return true;
+}
+
+/** Decode compressed block's data via given literal/length and distance
+ *  codes.
+ */
+static bool inflate_codes(
+    struct state * const s,
+    struct tree const * const lit,
+    struct tree const * const dist)
+{
+    while(true)
+    {
+        int sym = decode(s, lit);
+
+        if(sym < 0)
+        {
+            return false;
+        }
+        if(sym < 256) // Literal.
+        {
+            if(s->dest_pos == s->dest_len)
+            {
+                return false;
+            }
+            s->dest[s->dest_pos] = (uint8_t)sym;
+            ++s->dest_pos;
+            continue;
+        }
+        if(sym == 256)
+        {
+            return true; // End of block.
+        }
+
+        sym -= 257;
+        if(sym >= (int)sizeof s_len_base / (int)sizeof *s_len_base)
+        {
+            return false;
+        }
+
+        uint32_t const len = s_len_base[sym]
+            + get_bits(s, s_len_extra[sym]);
+
+        sym = decode(s, dist);
+        if(sym < 0
+            || sym >= (int)sizeof s_dist_base / (int)sizeof *s_dist_base)
+        {
+            return false;
+        }
+
+        uint32_t const d = s_dist_base[sym] + get_bits(s, s_dist_extra[sym]);
+
+        if(s->is_err || d > s->dest_pos || s->dest_len - s->dest_pos < len)
+        {
+            return false;
+        }
+        for(uint32_t i = 0;i < len;++i) // (source and target may overlap)
+        {
+            s->dest[s->dest_pos] = s->dest[s->dest_pos - d];
+            ++s->dest_pos;
+        }
+    }
+}
+
+static bool inflate_fixed(struct state * const s)
+{
+    uint8_t lens[MT_INFLATE_LIT_COUNT];
+    struct tree lit, dist;
+    int i = 0;
+
+    for(;i < 144;++i)
+    {
+        lens[i] = 8;
+    }
+    for(;i < 256;++i)
+    {
+        lens[i] = 9;
+    }
+    for(;i < 280;++i)
+    {
+        lens[i] = 7;
+    }
+    for(;i < MT_INFLATE_LIT_COUNT;++i)
+    {
+        lens[i] = 8;
+    }
+    build_tree(&lit, lens, MT_INFLATE_LIT_COUNT);
+
+    for(i = 0;i < MT_INFLATE_DIST_COUNT;++i)
+    {
+        lens[i] = 5;
+    }
+    build_tree(&dist, lens, MT_INFLATE_DIST_COUNT);
+
+    return inflate_codes(s, &lit, &dist);
+}
+
+static bool inflate_dynamic(struct state * const s)
+{
+    uint8_t lens[MT_INFLATE_LIT_COUNT + MT_INFLATE_DIST_COUNT];
+    struct tree lit, dist;
+    int const lit_count = (int)get_bits(s, 5) + 257,
+        dist_count = (int)get_bits(s, 5) + 1,
+        clen_count = (int)get_bits(s, 4) + 4;
+
+    if(s->is_err
+        || lit_count > 286 // (287 and 288 are not used)
+        || dist_count > 30)
+    {
+        return false;
+    }
+
+    // Code of code lengths:
+
+    for(int i = 0;i < MT_INFLATE_CLEN_COUNT;++i)
+    {
+        lens[s_clen_order[i]] = i < clen_count ? (uint8_t)get_bits(s, 3) : 0;
+    }
+    if(s->is_err || !build_tree(&lit, lens, MT_INFLATE_CLEN_COUNT))
+    {
+        return false;
+    }
+
+    // Code lengths of literal/length and distance codes:
+
+    for(int i = 0;i < lit_count + dist_count;)
+    {
+        int const sym = decode(s, &lit);
+        uint8_t len = 0;
+        int repeat = 1;
+
+        if(sym < 0)
+        {
+            return false;
+        }
+        if(sym < 16)
+        {
+            len = (uint8_t)sym;
+        }
+        else if(sym == 16) // Repeat last length.
+        {
+            if(i == 0)
+            {
+                return false;
+            }
+            len = lens[i - 1];
+            repeat = 3 + (int)get_bits(s, 2);
+        }
+        else if(sym == 17) // Repeat zero.
+        {
+            repeat = 3 + (int)get_bits(s, 3);
+        }
+        else // Repeat zero (more often).
+        {
+            repeat = 11 + (int)get_bits(s, 7);
+        }
+        if(s->is_err || i + repeat > lit_count + dist_count)
+        {
+            return false;
+        }
+        while(repeat > 0)
+        {
+            lens[i] = len;
+            ++i;
+            --repeat;
+        }
+    }
+    if(lens[256] == 0) // (end of block must be encodable)
+    {
+        return false;
+    }
+
+    return build_tree(&lit, lens, lit_count)
+        && build_tree(&dist, lens + lit_count, dist_count)
+        && inflate_codes(s, &lit, &dist);
+}
+
+bool inflate_decompress(
+    uint8_t const * const src,
+    uint32_t const src_len,
+    uint8_t * const dest,
+    uint32_t const dest_len,
+    uint32_t * const out_len)
+{
+    struct state s = {
+        .src = src,
+        .src_len = src_len,
+        .src_pos = 0,
+        .bits = 0,
+        .bit_count = 0,
+        .dest = dest,
+        .dest_len = dest_len,
+        .dest_pos = 0,
+        .is_err = false
+    };
+    bool is_last = false;
+
+    *out_len = 0;
+
+    while(!is_last)
+    {
+        bool is_ok = false;
+
+        is_last = get_bits(&s, 1) == 1;
+
+        switch(get_bits(&s, 2))
+        {
+            case 0:
+            {
+                is_ok = inflate_stored(&s);
+                break;
+            }
+            case 1:
+            {
+                is_ok = inflate_fixed(&s);
+                break;
+            }
+            case 2:
+            {
+                is_ok = inflate_dynamic(&s);
+                break;
+            }
+            default:
+            {
+                break; // Invalid block type.
+            }
+        }
+        if(!is_ok || s.is_err)
+        {
+            return false;
+        }
+    }
+
+    *out_len = s.dest_pos;
+    return true;
+}
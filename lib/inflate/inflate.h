@@ -0,0 +1,26 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Decompression of raw DEFLATE streams (RFC 1951, e.g. members of ZIP
+// archives), without zlib or gzip header.
+
+#ifndef MT_INFLATE
+#define MT_INFLATE
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Decompress given DEFLATE stream into given buffer and set count of bytes
+ *  written to it.
+ *
+ * - Returns false on error (e.g. if stream is invalid or does not fit into
+ *   given buffer).
+ */
+bool inflate_decompress(
+    uint8_t const * const src,
+    uint32_t const src_len,
+    uint8_t * const dest,
+    uint32_t const dest_len,
+    uint32_t * const out_len);
+
+#endif //MT_INFLATE
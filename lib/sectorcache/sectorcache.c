@@ -0,0 +1,502 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "sectorcache.h"
+#include "../alloc/alloc.h"
+#include "../mem/mem.h"
+#include "../sort/sort.h"
+#include "../assert.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef MT_LINUX
+    #include <string.h>
+#endif //MT_LINUX
+
+struct slot
+{
+    uint32_t sector;
+    bool is_used;
+    bool is_dirty;
+    bool is_ahead; // Read ahead and not requested, yet.
+
+    int prev; // More recently used slot or -1.
+    int next; // Less recently used slot or -1.
+    int hash_next; // Next slot in same hash bucket or -1.
+};
+
+static struct sectorcache_params s_params;
+
+static struct slot * s_slots = 0;
+static uint8_t * s_data = 0; // Sector content of each slot.
+static int * s_buckets = 0; // First slot in bucket or -1.
+static uint32_t s_bucket_mask = 0;
+static int * s_dirty = 0; // For flush.
+
+static uint8_t * s_buf = 0; // For read-ahead and merged write-back.
+static uint32_t s_buf_len = 0; // In sectors.
+
+static int s_head = -1; // Most recently used slot.
+static int s_tail = -1; // Least recently used slot.
+
+static uint32_t s_next_read = UINT32_MAX; // Sector after last read request.
+
+static struct sectorcache_stats s_stats;
+
+static uint8_t * get_data(int const i)
+{
+    return s_data + (uint32_t)i * MT_SECTORCACHE_SECTOR_LEN;
+}
+
+static int get_bucket(uint32_t const sector)
+{
+    return (int)(sector & s_bucket_mask);
+}
+
+static int find(uint32_t const sector)
+{
+    int i = s_buckets[get_bucket(sector)];
+
+    while(i != -1 && s_slots[i].sector != sector)
+    {
+        i = s_slots[i].hash_next;
+    }
+    return i;
+}
+
+static void unhash(int const i)
+{
+    int * p = s_buckets + get_bucket(s_slots[i].sector);
+
+    while(*p != i)
+    {
+        assert(*p != -1);
+        p = &(s_slots[*p].hash_next);
+    }
+    *p = s_slots[i].hash_next;
+    s_slots[i].hash_next = -1;
+}
+
+static void detach(int const i)
+{
+    struct slot * const s = s_slots + i;
+
+    if(s->prev == -1)
+    {
+        s_head = s->next;
+    }
+    else
+    {
+        s_slots[s->prev].next = s->next;
+    }
+    if(s->next == -1)
+    {
+        s_tail = s->prev;
+    }
+    else
+    {
+        s_slots[s->next].prev = s->prev;
+    }
+    s->prev = -1;
+    s->next = -1;
+}
+
+/** Make given slot the most recently used one.
+ */
+static void touch(int const i)
+{
+    if(s_head == i)
+    {
+        return;
+    }
+
+    detach(i);
+
+    s_slots[i].next = s_head;
+    if(s_head != -1)
+    {
+        s_slots[s_head].prev = i;
+    }
+    s_head = i;
+    if(s_tail == -1)
+    {
+        s_tail = i;
+    }
+}
+
+static bool write_back(int const i)
+{
+    assert(s_slots[i].is_used && s_slots[i].is_dirty);
+
+    if(!s_params.write(s_slots[i].sector, 1, get_data(i)))
+    {
+        return false;
+    }
+    s_slots[i].is_dirty = false;
+    ++s_stats.write_backs;
+    return true;
+}
+
+/** Return least recently used slot, made to be the most recently used one and
+ *  to hold given sector (content not set).
+ *
+ * - Returns -1, if the evicted sector could not be written back.
+ */
+static int claim(uint32_t const sector)
+{
+    int const i = s_tail;
+    struct slot * const s = s_slots + i;
+
+    if(s->is_used)
+    {
+        if(s->is_dirty && !write_back(i))
+        {
+            return -1;
+        }
+        unhash(i);
+    }
+
+    s->sector = sector;
+    s->is_used = true;
+    s->is_dirty = false;
+    s->is_ahead = false;
+    s->hash_next = s_buckets[get_bucket(sector)];
+    s_buckets[get_bucket(sector)] = i;
+
+    touch(i);
+    return i;
+}
+
+/** Cache given content of given sector, if not cached, already.
+ */
+static void insert(
+    uint32_t const sector, uint8_t const * const src, bool const is_ahead)
+{
+    if(find(sector) != -1)
+    {
+        return; // (may hold changes not written back, yet)
+    }
+
+    int const i = claim(sector);
+
+    if(i == -1)
+    {
+        return; // Just not cached.
+    }
+    memcpy(get_data(i), src, MT_SECTORCACHE_SECTOR_LEN);
+    s_slots[i].is_ahead = is_ahead;
+}
+
+/** Read given count of sectors not cached from backend and cache them.
+ */
+static bool read_run(
+    uint32_t const sector,
+    uint32_t const count,
+    uint8_t * const buf,
+    bool const with_ahead)
+{
+    s_stats.read_misses += count;
+
+    if(with_ahead
+        && count + s_params.read_ahead <= s_buf_len
+        && s_params.read(sector, count + s_params.read_ahead, s_buf))
+    {
+        memcpy(buf, s_buf, count * MT_SECTORCACHE_SECTOR_LEN);
+        for(uint32_t i = 0;i < count + s_params.read_ahead;++i)
+        {
+            insert(
+                sector + i,
+                s_buf + i * MT_SECTORCACHE_SECTOR_LEN,
+                i >= count);
+        }
+        s_stats.read_ahead += s_params.read_ahead;
+        return true;
+    }
+    // (otherwise e.g. read-ahead would go beyond end of medium)
+
+    if(!s_params.read(sector, count, buf))
+    {
+        return false;
+    }
+    for(uint32_t i = 0;i < count;++i)
+    {
+        insert(sector + i, buf + i * MT_SECTORCACHE_SECTOR_LEN, false);
+    }
+    return true;
+}
+
+static int cmp_dirty(void const * const a, void const * const b)
+{
+    uint32_t const sector_a = s_slots[*(int const *)a].sector,
+        sector_b = s_slots[*(int const *)b].sector;
+
+    if(sector_a < sector_b)
+    {
+        return -1;
+    }
+    return sector_a == sector_b ? 0 : 1;
+}
+
+static void free_all()
+{
+    alloc_free(s_slots);
+    s_slots = 0;
+    alloc_free(s_data);
+    s_data = 0;
+    alloc_free(s_buckets);
+    s_buckets = 0;
+    alloc_free(s_dirty);
+    s_dirty = 0;
+    alloc_free(s_buf);
+    s_buf = 0;
+}
+
+bool sectorcache_init(struct sectorcache_params const * const params)
+{
+    uint32_t bucket_count = 1;
+
+    assert(s_slots == 0);
+    assert(params->sector_count > 0);
+
+    s_params = *params;
+
+    while(bucket_count < s_params.sector_count)
+    {
+        bucket_count <<= 1;
+    }
+    s_bucket_mask = bucket_count - 1;
+    s_buf_len = s_params.read_ahead + 1;
+
+    s_slots = alloc_alloc(s_params.sector_count * sizeof *s_slots);
+    s_data = alloc_alloc(s_params.sector_count * MT_SECTORCACHE_SECTOR_LEN);
+    s_buckets = alloc_alloc(bucket_count * sizeof *s_buckets);
+    s_dirty = alloc_alloc(s_params.sector_count * sizeof *s_dirty);
+    s_buf = alloc_alloc(s_buf_len * MT_SECTORCACHE_SECTOR_LEN);
+    if(s_slots == 0 || s_data == 0 || s_buckets == 0 || s_dirty == 0
+        || s_buf == 0)
+    {
+        free_all();
+        return false;
+    }
+
+    sectorcache_invalidate();
+    return true;
+}
+
+bool sectorcache_deinit()
+{
+    if(s_slots == 0)
+    {
+        return true;
+    }
+    if(!sectorcache_flush())
+    {
+        return false;
+    }
+    free_all();
+    return true;
+}
+
+bool sectorcache_read(
+    uint32_t const sector, uint32_t const count, uint8_t * const buf)
+{
+    bool const is_sequential = sector == s_next_read;
+    uint32_t i = 0;
+
+    s_next_read = sector + count;
+
+    while(i < count)
+    {
+        int const slot = find(sector + i);
+
+        if(slot != -1)
+        {
+            memcpy(
+                buf + i * MT_SECTORCACHE_SECTOR_LEN,
+                get_data(slot),
+                MT_SECTORCACHE_SECTOR_LEN);
+            touch(slot);
+            ++s_stats.read_hits;
+            if(s_slots[slot].is_ahead)
+            {
+                s_slots[slot].is_ahead = false;
+                ++s_stats.read_ahead_hits;
+            }
+            ++i;
+            continue;
+        }
+
+        uint32_t run = 1; // Count of consecutive sectors not cached.
+
+        while(i + run < count && find(sector + i + run) == -1)
+        {
+            ++run;
+        }
+
+        if(!read_run(
+                sector + i,
+                run,
+                buf + i * MT_SECTORCACHE_SECTOR_LEN,
+                is_sequential && i + run == count))
+        {
+            s_next_read = UINT32_MAX;
+            return false;
+        }
+        i += run;
+    }
+    return true;
+}
+
+bool sectorcache_write(
+    uint32_t const sector, uint32_t const count, uint8_t const * const buf)
+{
+    s_stats.writes += count;
+
+    if(count == 1)
+    {
+        int i = find(sector);
+
+        if(i == -1)
+        {
+            i = claim(sector);
+        }
+        else
+        {
+            touch(i);
+        }
+        if(i != -1)
+        {
+            memcpy(get_data(i), buf, MT_SECTORCACHE_SECTOR_LEN);
+            s_slots[i].is_dirty = true;
+            s_slots[i].is_ahead = false;
+            return true;
+        }
+        // (otherwise writes through)
+    }
+
+    // File content is written through, at once, because it is not going to
+    // be changed again, soon:
+
+    if(!s_params.write(sector, count, buf))
+    {
+        return false;
+    }
+    s_stats.write_backs += count;
+
+    for(uint32_t i = 0;i < count;++i)
+    {
+        int const slot = find(sector + i);
+
+        if(slot != -1)
+        {
+            memcpy(
+                get_data(slot),
+                buf + i * MT_SECTORCACHE_SECTOR_LEN,
+                MT_SECTORCACHE_SECTOR_LEN);
+            s_slots[slot].is_dirty = false;
+        }
+    }
+    return true;
+}
+
+bool sectorcache_flush()
+{
+    int count = 0, beg = 0;
+
+    if(s_slots == 0)
+    {
+        return true;
+    }
+
+    for(int i = 0;i < (int)s_params.sector_count;++i)
+    {
+        if(s_slots[i].is_used && s_slots[i].is_dirty)
+        {
+            s_dirty[count++] = i;
+        }
+    }
+    if(count == 0)
+    {
+        return true;
+    }
+
+    sort_intro(s_dirty, (size_t)count, sizeof *s_dirty, cmp_dirty);
+
+    while(beg < count)
+    {
+        uint32_t const sector = s_slots[s_dirty[beg]].sector;
+        int end = beg + 1;
+
+        while(end < count
+            && (uint32_t)(end - beg) < s_buf_len
+            && s_slots[s_dirty[end]].sector
+                == sector + (uint32_t)(end - beg))
+        {
+            ++end;
+        }
+
+        if(end - beg == 1)
+        {
+            if(!write_back(s_dirty[beg]))
+            {
+                return false;
+            }
+            beg = end;
+            continue;
+        }
+
+        for(int i = beg;i < end;++i)
+        {
+            memcpy(
+                s_buf + (uint32_t)(i - beg) * MT_SECTORCACHE_SECTOR_LEN,
+                get_data(s_dirty[i]),
+                MT_SECTORCACHE_SECTOR_LEN);
+        }
+        if(!s_params.write(sector, (uint32_t)(end - beg), s_buf))
+        {
+            return false;
+        }
+        for(int i = beg;i < end;++i)
+        {
+            s_slots[s_dirty[i]].is_dirty = false;
+        }
+        s_stats.write_backs += (uint32_t)(end - beg);
+        beg = end;
+    }
+    return true;
+}
+
+void sectorcache_invalidate()
+{
+    int const len = (int)s_params.sector_count;
+
+    if(s_slots == 0)
+    {
+        return;
+    }
+
+    for(uint32_t i = 0;i <= s_bucket_mask;++i)
+    {
+        s_buckets[i] = -1;
+    }
+    for(int i = 0;i < len;++i)
+    {
+        s_slots[i].sector = 0;
+        s_slots[i].is_used = false;
+        s_slots[i].is_dirty = false;
+        s_slots[i].is_ahead = false;
+        s_slots[i].prev = i - 1;
+        s_slots[i].next = i + 1 < len ? i + 1 : -1;
+        s_slots[i].hash_next = -1;
+    }
+    s_head = 0;
+    s_tail = len - 1;
+    s_next_read = UINT32_MAX;
+}
+
+void sectorcache_get_stats(struct sectorcache_stats * const stats)
+{
+    *stats = s_stats;
+}
@@ -0,0 +1,64 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Singleton (!) LRU cache of 512 byte sectors between a file system (FatFs)
+// and a block device.
+//
+// - Single-sector writes (FAT, directory, etc., via the FatFs sector window)
+//   are written back on flush or eviction, only.
+// - Multi-sector writes (file content) are written through, at once.
+// - Sequential single-sector reads make the cache read ahead.
+// - Independent from hardware (backend given via parameters), so it can also
+//   be used on Linux with an image file as backend.
+
+#ifndef MT_SECTORCACHE
+#define MT_SECTORCACHE
+
+#include "sectorcache_params.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MT_SECTORCACHE_SECTOR_LEN 512
+
+struct sectorcache_stats
+{
+    uint32_t read_hits; // Sectors requested and found in cache.
+    uint32_t read_misses; // Sectors requested and read from backend.
+    uint32_t read_ahead; // Sectors read ahead from backend.
+    uint32_t read_ahead_hits; // Read ahead sectors requested later.
+    uint32_t writes; // Sectors written to cache.
+    uint32_t write_backs; // Sectors written to backend.
+};
+
+/** Allocate cache with given parameters (copied).
+ *
+ * - Returns false on error (e.g. not enough memory).
+ */
+bool sectorcache_init(struct sectorcache_params const * const params);
+
+/** Write back all sectors and free cache.
+ *
+ * - OK to be called, if not initialized.
+ */
+bool sectorcache_deinit();
+
+bool sectorcache_read(
+    uint32_t const sector, uint32_t const count, uint8_t * const buf);
+
+bool sectorcache_write(
+    uint32_t const sector, uint32_t const count, uint8_t const * const buf);
+
+/** Write back all changed sectors in ascending order, merging neighbours into
+ *  one backend write (as far as the read-ahead buffer allows).
+ */
+bool sectorcache_flush();
+
+/** Forget all cached sectors WITHOUT writing them back (e.g. after the medium
+ *  got changed).
+ */
+void sectorcache_invalidate();
+
+void sectorcache_get_stats(struct sectorcache_stats * const stats);
+
+#endif //MT_SECTORCACHE
@@ -0,0 +1,24 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#ifndef MT_SECTORCACHE_PARAMS
+#define MT_SECTORCACHE_PARAMS
+
+#include <stdint.h>
+#include <stdbool.h>
+
+struct sectorcache_params
+{
+    // Read/write given count of sectors starting at given sector from/to
+    // backend (e.g. SD card or image file), return true on success:
+    //
+    bool (*read)(
+        uint32_t const sector, uint32_t const count, uint8_t * const buf);
+    bool (*write)(
+        uint32_t const sector, uint32_t const count, uint8_t const * const buf);
+
+    uint32_t sector_count; // Count of sectors to cache.
+    uint32_t read_ahead; // Sectors to read ahead on sequential reads (or 0).
+};
+
+#endif //MT_SECTORCACHE_PARAMS
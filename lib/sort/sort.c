@@ -7,6 +7,54 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
+
+#ifdef MT_LINUX
+    #include <string.h>
+#endif //MT_LINUX
+
+// Arrays (or parts of arrays) up to this length are sorted via insertion sort
+// (by introsort and merge sort):
+//
+#define MT_SORT_SMALL_LEN 16
+
+static void swap(uint8_t * const a, uint8_t * const b, size_t const ele_len)
+{
+    for(size_t i = 0;i < ele_len;++i)
+    {
+        uint8_t const t = a[i];
+
+        a[i] = b[i];
+        b[i] = t;
+    }
+}
+
+static void swap_ptr(void * * const a, void * * const b)
+{
+    void * const t = *a;
+
+    *a = *b;
+    *b = t;
+}
+
+/** Return maximum recursion depth of introsort for given count of elements,
+ *  before falling back to heap sort (2 * log2(n)).
+ */
+static size_t get_depth_limit(size_t len)
+{
+    size_t ret_val = 0;
+
+    while(len > 1)
+    {
+        len >>= 1;
+        ++ret_val;
+    }
+    return 2 * ret_val;
+}
+
+// *****************************************************************************
+// *** Generic (any element length):                                         ***
+// *****************************************************************************
 
 void sort_insertion(
     void * const arr,
@@ -14,38 +62,474 @@ void sort_insertion(
     size_t const ele_len,
     int (*cmp)(void const *, void const *))
 {
-    uint8_t * const t = alloc_alloc(ele_len * sizeof *t);
+    uint8_t * const a = arr;
+
+    // Swaps neighbours instead of using a temporary element, to not need an
+    // allocation:
 
     for(size_t i = 1;i < arr_len;++i)
     {
-        size_t j = i;
+        for(size_t j = i;j >= 1;--j)
+        {
+            uint8_t * const cur = a + j * ele_len;
+
+            if(cmp(cur - ele_len, cur) <= 0)
+            {
+                break; // arr[j - 1] <= arr[j]
+            }
+            swap(cur - ele_len, cur, ele_len);
+        }
+    }
+}
 
-        // Save original element found at index i:
+/** Move element at given index down in max-heap of given length, until both
+ *  children are not greater.
+ */
+static void sift_down(
+    uint8_t * const arr,
+    size_t i,
+    size_t const len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *))
+{
+    while(true)
+    {
+        size_t max = i;
+        size_t const left = 2 * i + 1, right = left + 1;
+
+        if(left < len && cmp(arr + left * ele_len, arr + max * ele_len) > 0)
+        {
+            max = left;
+        }
+        if(right < len && cmp(arr + right * ele_len, arr + max * ele_len) > 0)
+        {
+            max = right;
+        }
+        if(max == i)
+        {
+            return;
+        }
+        swap(arr + i * ele_len, arr + max * ele_len, ele_len);
+        i = max;
+    }
+}
+
+void sort_heap(
+    void * const arr,
+    size_t const arr_len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *))
+{
+    uint8_t * const a = arr;
+
+    if(arr_len < 2)
+    {
+        return;
+    }
+
+    for(size_t i = arr_len / 2;i > 0;--i) // Builds max-heap.
+    {
+        sift_down(a, i - 1, arr_len, ele_len, cmp);
+    }
+    for(size_t len = arr_len - 1;len > 0;--len)
+    {
+        swap(a, a + len * ele_len, ele_len); // Moves max. to end.
+        sift_down(a, 0, len, ele_len, cmp);
+    }
+}
+
+/** Partition given array around median of first, middle and last element
+ *  and return index of that pivot element afterwards.
+ *
+ * - Expects array to hold at least three elements.
+ */
+static size_t partition(
+    uint8_t * const a,
+    size_t const len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *))
+{
+    uint8_t * const mid = a + (len / 2) * ele_len,
+        * const last = a + (len - 1) * ele_len;
+    size_t i = 0, j = len;
+
+    if(cmp(mid, a) < 0)
+    {
+        swap(mid, a, ele_len);
+    }
+    if(cmp(last, a) < 0)
+    {
+        swap(last, a, ele_len);
+    }
+    if(cmp(last, mid) < 0)
+    {
+        swap(last, mid, ele_len);
+    }
+    swap(a, mid, ele_len); // Pivot is first element, last is not smaller.
+
+    while(true)
+    {
+        do
+        {
+            ++i;
+        }while(i < len && cmp(a + i * ele_len, a) < 0);
+        do
+        {
+            --j;
+        }while(cmp(a + j * ele_len, a) > 0);
+
+        if(i >= j)
+        {
+            break;
+        }
+        swap(a + i * ele_len, a + j * ele_len, ele_len);
+    }
+    swap(a, a + j * ele_len, ele_len);
+    return j;
+}
+
+static void intro(
+    uint8_t * a,
+    size_t len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *),
+    size_t depth)
+{
+    while(len > MT_SORT_SMALL_LEN)
+    {
+        if(depth == 0)
+        {
+            sort_heap(a, len, ele_len, cmp); // (avoids quicksort's worst case)
+            return;
+        }
+        --depth;
+
+        size_t const p = partition(a, len, ele_len, cmp);
+
+        // Recurses into smaller part, only (limits stack usage):
         //
-        memcpy(t, ((uint8_t const *)arr + i * ele_len), ele_len);
+        if(p < len - p - 1)
+        {
+            intro(a, p, ele_len, cmp, depth);
+            a += (p + 1) * ele_len;
+            len -= p + 1;
+        }
+        else
+        {
+            intro(a + (p + 1) * ele_len, len - p - 1, ele_len, cmp, depth);
+            len = p;
+        }
+    }
+    sort_insertion(a, len, ele_len, cmp);
+}
+
+void sort_intro(
+    void * const arr,
+    size_t const arr_len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *))
+{
+    intro(arr, arr_len, ele_len, cmp, get_depth_limit(arr_len));
+}
 
-        while(j >= 1)
+void sort_merge(
+    void * const arr,
+    size_t const arr_len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *))
+{
+    uint8_t * src = arr,
+        * dst = 0;
+
+    if(arr_len <= MT_SORT_SMALL_LEN)
+    {
+        sort_insertion(arr, arr_len, ele_len, cmp);
+        return;
+    }
+
+    dst = alloc_alloc(arr_len * ele_len);
+    if(dst == 0)
+    {
+        sort_insertion(arr, arr_len, ele_len, cmp);
+        return;
+    }
+
+    // Sorted runs of small length to start with:
+    //
+    for(size_t beg = 0;beg < arr_len;beg += MT_SORT_SMALL_LEN)
+    {
+        size_t const len = arr_len - beg < MT_SORT_SMALL_LEN
+            ? arr_len - beg : MT_SORT_SMALL_LEN;
+
+        sort_insertion(src + beg * ele_len, len, ele_len, cmp);
+    }
+
+    // Merge neighbouring runs, alternating between array and buffer:
+    //
+    for(size_t width = MT_SORT_SMALL_LEN;width < arr_len;width *= 2)
+    {
+        for(size_t beg = 0;beg < arr_len;beg += 2 * width)
         {
-            // Pointer to element at index j - 1:
-            //
-            void const * const s = ((uint8_t const *)arr + (j - 1) * ele_len);
+            size_t const mid = beg + width < arr_len ? beg + width : arr_len,
+                lim = mid + width < arr_len ? mid + width : arr_len;
+            size_t i = beg, j = mid, k = beg;
 
-            if(cmp(s, t) <= 0)
+            while(i < mid && j < lim)
             {
-                break; // arr[j - 1] <= t
+                // Takes left element, if equal (keeps it stable):
+                //
+                if(cmp(src + j * ele_len, src + i * ele_len) < 0)
+                {
+                    memcpy(dst + k * ele_len, src + j * ele_len, ele_len);
+                    ++j;
+                }
+                else
+                {
+                    memcpy(dst + k * ele_len, src + i * ele_len, ele_len);
+                    ++i;
+                }
+                ++k;
             }
+            memcpy(dst + k * ele_len, src + i * ele_len, (mid - i) * ele_len);
+            k += mid - i;
+            memcpy(dst + k * ele_len, src + j * ele_len, (lim - j) * ele_len);
+        }
+
+        uint8_t * const t = src;
+
+        src = dst;
+        dst = t;
+    }
+
+    if(src != arr) // Result is in buffer.
+    {
+        memcpy(arr, src, arr_len * ele_len);
+        dst = src;
+    }
+    alloc_free(dst);
+}
+
+// *****************************************************************************
+// *** Pointer arrays:                                                       ***
+// *****************************************************************************
+
+static void insertion_ptr(
+    void * * const a,
+    size_t const len,
+    int (*cmp)(void const *, void const *))
+{
+    for(size_t i = 1;i < len;++i)
+    {
+        void * const t = a[i];
+        size_t j = i;
+
+        while(j >= 1 && cmp(&a[j - 1], &t) > 0)
+        {
+            a[j] = a[j - 1];
+            --j;
+        }
+        a[j] = t;
+    }
+}
 
-            // arr[j - 1] > t
+static void sift_down_ptr(
+    void * * const a,
+    size_t i,
+    size_t const len,
+    int (*cmp)(void const *, void const *))
+{
+    while(true)
+    {
+        size_t max = i;
+        size_t const left = 2 * i + 1, right = left + 1;
 
-            memcpy( // arr[j] = arr[j - 1]
-                (uint8_t*)arr + j * ele_len,
-                (uint8_t const *)arr + (j - 1) * ele_len,
-                ele_len);
+        if(left < len && cmp(&a[left], &a[max]) > 0)
+        {
+            max = left;
+        }
+        if(right < len && cmp(&a[right], &a[max]) > 0)
+        {
+            max = right;
+        }
+        if(max == i)
+        {
+            return;
+        }
+        swap_ptr(&a[i], &a[max]);
+        i = max;
+    }
+}
+
+static void heap_ptr(
+    void * * const a,
+    size_t const len,
+    int (*cmp)(void const *, void const *))
+{
+    if(len < 2)
+    {
+        return;
+    }
+    for(size_t i = len / 2;i > 0;--i)
+    {
+        sift_down_ptr(a, i - 1, len, cmp);
+    }
+    for(size_t l = len - 1;l > 0;--l)
+    {
+        swap_ptr(&a[0], &a[l]);
+        sift_down_ptr(a, 0, l, cmp);
+    }
+}
+
+/** See partition().
+ */
+static size_t partition_ptr(
+    void * * const a,
+    size_t const len,
+    int (*cmp)(void const *, void const *))
+{
+    size_t const mid = len / 2, last = len - 1;
+    size_t i = 0, j = len;
+
+    if(cmp(&a[mid], &a[0]) < 0)
+    {
+        swap_ptr(&a[mid], &a[0]);
+    }
+    if(cmp(&a[last], &a[0]) < 0)
+    {
+        swap_ptr(&a[last], &a[0]);
+    }
+    if(cmp(&a[last], &a[mid]) < 0)
+    {
+        swap_ptr(&a[last], &a[mid]);
+    }
+    swap_ptr(&a[0], &a[mid]);
 
+    while(true)
+    {
+        do
+        {
+            ++i;
+        }while(i < len && cmp(&a[i], &a[0]) < 0);
+        do
+        {
             --j;
+        }while(cmp(&a[j], &a[0]) > 0);
+
+        if(i >= j)
+        {
+            break;
+        }
+        swap_ptr(&a[i], &a[j]);
+    }
+    swap_ptr(&a[0], &a[j]);
+    return j;
+}
+
+static void intro_ptr(
+    void * * a,
+    size_t len,
+    int (*cmp)(void const *, void const *),
+    size_t depth)
+{
+    while(len > MT_SORT_SMALL_LEN)
+    {
+        if(depth == 0)
+        {
+            heap_ptr(a, len, cmp);
+            return;
+        }
+        --depth;
+
+        size_t const p = partition_ptr(a, len, cmp);
+
+        if(p < len - p - 1)
+        {
+            intro_ptr(a, p, cmp, depth);
+            a += p + 1;
+            len -= p + 1;
+        }
+        else
+        {
+            intro_ptr(a + p + 1, len - p - 1, cmp, depth);
+            len = p;
         }
-        memcpy((uint8_t*)arr + j * ele_len, t, ele_len); // arr[j] = t
     }
+    insertion_ptr(a, len, cmp);
+}
+
+void sort_ptr_intro(
+    void * * const arr,
+    size_t const arr_len,
+    int (*cmp)(void const *, void const *))
+{
+    intro_ptr(arr, arr_len, cmp, get_depth_limit(arr_len));
+}
+
+void sort_ptr_merge(
+    void * * const arr,
+    size_t const arr_len,
+    int (*cmp)(void const *, void const *))
+{
+    void * * src = arr,
+        * * dst = 0;
 
-    alloc_free(t);
+    if(arr_len <= MT_SORT_SMALL_LEN)
+    {
+        insertion_ptr(arr, arr_len, cmp);
+        return;
+    }
+
+    dst = alloc_alloc(arr_len * sizeof *dst);
+    if(dst == 0)
+    {
+        insertion_ptr(arr, arr_len, cmp);
+        return;
+    }
+
+    for(size_t beg = 0;beg < arr_len;beg += MT_SORT_SMALL_LEN)
+    {
+        insertion_ptr(
+            src + beg,
+            arr_len - beg < MT_SORT_SMALL_LEN
+                ? arr_len - beg : MT_SORT_SMALL_LEN,
+            cmp);
+    }
+
+    for(size_t width = MT_SORT_SMALL_LEN;width < arr_len;width *= 2)
+    {
+        for(size_t beg = 0;beg < arr_len;beg += 2 * width)
+        {
+            size_t const mid = beg + width < arr_len ? beg + width : arr_len,
+                lim = mid + width < arr_len ? mid + width : arr_len;
+            size_t i = beg, j = mid, k = beg;
+
+            while(i < mid && j < lim)
+            {
+                dst[k++] = cmp(&src[j], &src[i]) < 0 ? src[j++] : src[i++];
+            }
+            while(i < mid)
+            {
+                dst[k++] = src[i++];
+            }
+            while(j < lim)
+            {
+                dst[k++] = src[j++];
+            }
+        }
+
+        void * * const t = src;
+
+        src = dst;
+        dst = t;
+    }
+
+    if(src != arr)
+    {
+        for(size_t i = 0;i < arr_len;++i)
+        {
+            arr[i] = src[i];
+        }
+        dst = src;
+    }
+    alloc_free(dst);
 }
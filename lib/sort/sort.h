@@ -12,9 +12,12 @@
 // {
 //     return str_cmp(*(char const * const *)a, *(char const * const *)b);
 // }
+//
+// - Compare functions always get pointers to the array elements, also for the
+//   sort_ptr_...() functions (so the same compare function can be used).
 
 /** Sort elements in given array in-place via given compare function and
- *  insertion sort algorithm.
+ *  insertion sort algorithm [O(n^2), stable, fast for small arrays].
  */
 void sort_insertion(
     void * const arr,
@@ -22,4 +25,52 @@ void sort_insertion(
     size_t const ele_len,
     int (*cmp)(void const *, void const *));
 
+/** Sort elements in given array in-place via given compare function and
+ *  heap sort algorithm [O(n log n), not stable].
+ */
+void sort_heap(
+    void * const arr,
+    size_t const arr_len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *));
+
+/** Sort elements in given array in-place via given compare function and
+ *  introsort algorithm [quicksort falling back to heap sort, O(n log n), not
+ *  stable].
+ *
+ * - To be used by default.
+ */
+void sort_intro(
+    void * const arr,
+    size_t const arr_len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *));
+
+/** Sort elements in given array via given compare function and merge sort
+ *  algorithm [O(n log n), stable].
+ *
+ * - Allocates a buffer of the array's size (falls back to insertion sort, if
+ *   this fails).
+ */
+void sort_merge(
+    void * const arr,
+    size_t const arr_len,
+    size_t const ele_len,
+    int (*cmp)(void const *, void const *));
+
+/** Same as sort_intro(), but for an array of pointers (moves pointers instead
+ *  of copying element bytes).
+ */
+void sort_ptr_intro(
+    void * * const arr,
+    size_t const arr_len,
+    int (*cmp)(void const *, void const *));
+
+/** Same as sort_merge(), but for an array of pointers.
+ */
+void sort_ptr_merge(
+    void * * const arr,
+    size_t const arr_len,
+    int (*cmp)(void const *, void const *));
+
 #endif //MT_SORT
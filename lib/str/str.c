@@ -272,3 +272,49 @@ bool str_are_equal(char const * const a, char const * const b)
 {
     return str_cmp(a, b) == 0;
 }
+
+static bool is_equal_ignore_case(char const a, char const b)
+{
+    return (is_upper_case_letter(a) ? get_lower_case(a) : a)
+        == (is_upper_case_letter(b) ? get_lower_case(b) : b);
+}
+
+bool str_is_matching(char const * const s, char const * const pattern)
+{
+    int i = 0, k = 0,
+        star_k = -1, // Index of character in pattern after last '*' found.
+        star_i = 0; // Index of character in s matched against it.
+
+    while(s[i] != '\0')
+    {
+        if(pattern[k] == '*')
+        {
+            ++k;
+            star_k = k;
+            star_i = i;
+            continue;
+        }
+        if(pattern[k] != '\0'
+            && (pattern[k] == '?' || is_equal_ignore_case(pattern[k], s[i])))
+        {
+            ++i;
+            ++k;
+            continue;
+        }
+        if(star_k == -1)
+        {
+            return false;
+        }
+
+        // Let last '*' match one more character and retry:
+        //
+        ++star_i;
+        i = star_i;
+        k = star_k;
+    }
+    while(pattern[k] == '*')
+    {
+        ++k;
+    }
+    return pattern[k] == '\0';
+}
@@ -85,4 +85,12 @@ int str_cmp(char const * const a, char const * const b);
 
 bool str_are_equal(char const * const a, char const * const b);
 
+/** Return true, if given string matches given pattern, ignoring case of
+ *  letters.
+ *
+ * - '*' in pattern matches any count of characters (including zero).
+ * - '?' in pattern matches exactly one character.
+ */
+bool str_is_matching(char const * const s, char const * const pattern);
+
 #endif //MT_STR
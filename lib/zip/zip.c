@@ -0,0 +1,485 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+#include "zip.h"
+#include "../alloc/alloc.h"
+#include "../str/str.h"
+#include "../dir/dir.h"
+#include "../filesys/filesys.h"
+#include "../filecache/filecache.h"
+#include "../inflate/inflate.h"
+#include "../ff14/source/ff.h"
+
+#ifndef NDEBUG
+    #include "../console/console.h"
+#endif //NDEBUG
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MT_ZIP_EOCD_SIG 0x06054b50 // End of central directory record.
+#define MT_ZIP_EOCD_LEN 22 // Without comment.
+#define MT_ZIP_MAX_COMMENT_LEN 0xFFFF
+#define MT_ZIP_CDH_SIG 0x02014b50 // Central directory file header.
+#define MT_ZIP_CDH_LEN 46 // Without name, extra field and comment.
+#define MT_ZIP_LFH_SIG 0x04034b50 // Local file header.
+#define MT_ZIP_LFH_LEN 30 // Without name and extra field.
+#define MT_ZIP_METHOD_STORED 0
+#define MT_ZIP_METHOD_DEFLATED 8
+#define MT_ZIP_FLAG_ENCRYPTED 0x0001
+
+struct member
+{
+    char * name; // Full name in archive (may include subfolders).
+    char const * file_name; // Part of name without subfolders.
+    uint32_t offset; // Of local file header in archive.
+    uint32_t compressed_len;
+    uint32_t byte_count; // Decompressed.
+    uint32_t crc;
+    uint16_t method;
+};
+
+static char * s_path = 0; // Full path of mounted archive, 0 if not mounted.
+static FSIZE_t s_size = 0; // Of archive file at mount.
+static WORD s_date = 0; // Of last modification of archive file at mount.
+static WORD s_time = 0;
+static struct member * s_members = 0; // In order of central directory.
+static int s_member_count = 0;
+
+static uint32_t s_crc_table[256];
+static bool s_crc_table_is_filled = false;
+
+static uint16_t get_u16(uint8_t const * const p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(uint8_t const * const p)
+{
+    return (uint32_t)p[0]
+        | ((uint32_t)p[1] << 8)
+        | ((uint32_t)p[2] << 16)
+        | ((uint32_t)p[3] << 24);
+}
+
+/** Return CRC-32 (as used by ZIP) of given bytes.
+ */
+static uint32_t get_crc(uint8_t const * const bytes, uint32_t const count)
+{
+    uint32_t ret_val = 0xFFFFFFFF;
+
+    if(!s_crc_table_is_filled)
+    {
+        for(uint32_t i = 0;i < 256;++i)
+        {
+            uint32_t c = i;
+
+            for(int j = 0;j < 8;++j)
+            {
+                c = (c & 1) == 0 ? c >> 1 : 0xEDB88320 ^ (c >> 1);
+            }
+            s_crc_table[i] = c;
+        }
+        s_crc_table_is_filled = true;
+    }
+
+    for(uint32_t i = 0;i < count;++i)
+    {
+        ret_val = s_crc_table[(ret_val ^ bytes[i]) & 0xFF] ^ (ret_val >> 8);
+    }
+    return ret_val ^ 0xFFFFFFFF;
+}
+
+/** Read given count of bytes at given position of given file into given
+ *  buffer.
+ */
+static bool read_at(
+    FIL * const fil,
+    FSIZE_t const pos,
+    uint8_t * const buf,
+    uint32_t const count)
+{
+    UINT read_len = 0;
+
+    return f_lseek(fil, pos) == FR_OK
+        && f_read(fil, buf, (UINT)count, &read_len) == FR_OK
+        && (uint32_t)read_len == count;
+}
+
+static void free_members()
+{
+    for(int i = 0;i < s_member_count;++i)
+    {
+        alloc_free(s_members[i].name);
+    }
+    alloc_free(s_members);
+    s_members = 0;
+    s_member_count = 0;
+}
+
+/** Find end of central directory record of archive with given size and get
+ *  offset, size and entry count of central directory.
+ */
+static bool read_eocd(
+    FIL * const fil,
+    FSIZE_t const size,
+    uint32_t * const out_cd_offset,
+    uint32_t * const out_cd_len,
+    uint32_t * const out_entry_count)
+{
+    // The record is followed by a comment of up to 64 KiB, so search in the
+    // last bytes of the archive:
+    //
+    uint32_t const tail_len = size < MT_ZIP_EOCD_LEN + MT_ZIP_MAX_COMMENT_LEN
+            ? (uint32_t)size
+            : MT_ZIP_EOCD_LEN + MT_ZIP_MAX_COMMENT_LEN;
+    uint8_t * tail = 0;
+    bool ret_val = false;
+
+    if(tail_len < MT_ZIP_EOCD_LEN)
+    {
+        return false;
+    }
+    tail = alloc_alloc(tail_len);
+    if(tail == 0)
+    {
+        return false;
+    }
+    if(!read_at(fil, size - tail_len, tail, tail_len))
+    {
+        alloc_free(tail);
+        return false;
+    }
+
+    for(int i = (int)(tail_len - MT_ZIP_EOCD_LEN);i >= 0;--i)
+    {
+        uint8_t const * const e = tail + i;
+
+        if(get_u32(e) != MT_ZIP_EOCD_SIG
+            || (uint32_t)i + MT_ZIP_EOCD_LEN + get_u16(e + 20) > tail_len)
+        {
+            continue;
+        }
+
+        *out_entry_count = get_u16(e + 10);
+        *out_cd_len = get_u32(e + 12);
+        *out_cd_offset = get_u32(e + 16);
+
+        // Multi-disk and ZIP64 archives are not supported:
+        //
+        ret_val = get_u16(e + 4) == 0
+            && get_u16(e + 6) == 0
+            && *out_entry_count != 0xFFFF
+            && *out_cd_offset != 0xFFFFFFFF
+            && (FSIZE_t)*out_cd_offset + *out_cd_len <= size;
+        break;
+    }
+
+    alloc_free(tail);
+    return ret_val;
+}
+
+/** Parse given central directory with given count of entries into index.
+ *
+ * - Skips folders and members that are not supported.
+ */
+static bool parse(
+    uint8_t const * const cd, uint32_t const len, uint32_t const entry_count)
+{
+    uint32_t pos = 0;
+
+    s_members = alloc_alloc((entry_count + 1) * sizeof *s_members);
+    //
+    // (+1 for empty archive)
+    if(s_members == 0)
+    {
+        return false;
+    }
+
+    for(uint32_t i = 0;i < entry_count;++i)
+    {
+        if(len - pos < MT_ZIP_CDH_LEN)
+        {
+            return false;
+        }
+
+        uint8_t const * const h = cd + pos;
+        uint32_t const name_len = get_u16(h + 28),
+            next = pos + MT_ZIP_CDH_LEN
+                + name_len + get_u16(h + 30) + get_u16(h + 32);
+        struct member * const m = s_members + s_member_count;
+
+        if(get_u32(h) != MT_ZIP_CDH_SIG || next > len)
+        {
+            return false;
+        }
+        pos = next;
+
+        m->method = get_u16(h + 10);
+        m->crc = get_u32(h + 16);
+        m->compressed_len = get_u32(h + 20);
+        m->byte_count = get_u32(h + 24);
+        m->offset = get_u32(h + 42);
+
+        if(name_len == 0
+            || h[MT_ZIP_CDH_LEN + name_len - 1] == '/' // Folder.
+            || (get_u16(h + 8) & MT_ZIP_FLAG_ENCRYPTED) != 0
+            || (m->method != MT_ZIP_METHOD_STORED
+                && m->method != MT_ZIP_METHOD_DEFLATED)
+            || m->compressed_len == 0xFFFFFFFF // ZIP64.
+            || m->byte_count == 0xFFFFFFFF
+            || m->offset == 0xFFFFFFFF)
+        {
+#ifndef NDEBUG
+            console_writeline("zip/parse : Skipped entry (not supported).");
+#endif //NDEBUG
+            continue;
+        }
+
+        m->name = alloc_alloc(name_len + 1);
+        if(m->name == 0)
+        {
+            return false;
+        }
+        for(uint32_t j = 0;j < name_len;++j) // (header is not a string)
+        {
+            m->name[j] = (char)h[MT_ZIP_CDH_LEN + j];
+        }
+        m->name[name_len] = '\0';
+        m->file_name = m->name + str_get_last_index(m->name, '/') + 1;
+        ++s_member_count;
+    }
+    return true;
+}
+
+/** Return true, if mounted archive is still the same on SD card.
+ */
+static bool is_unchanged()
+{
+    FILINFO info;
+
+    return f_stat(s_path, &info) == FR_OK
+        && info.fsize == s_size
+        && info.fdate == s_date
+        && info.ftime == s_time;
+}
+
+/** Mount mounted archive again, if it got changed on SD card.
+ */
+static bool refresh()
+{
+    if(s_path == 0)
+    {
+        return false;
+    }
+
+    filesys_mount();
+    if(is_unchanged())
+    {
+        return true;
+    }
+
+    char * const full_path = str_create_copy(s_path);
+    bool const ret_val = zip_mount(full_path);
+
+    alloc_free(full_path);
+    return ret_val;
+}
+
+/** Load (decompressed) content of given member of mounted archive and set
+ *  byte count.
+ */
+static uint8_t * load(
+    struct member const * const m, uint32_t * const out_byte_count)
+{
+    FIL fil;
+    uint8_t header[MT_ZIP_LFH_LEN];
+    uint8_t * src = 0;
+    uint32_t len = 0;
+    bool is_ok = false;
+    char * const key = str_create_concat_three(s_path, "/", m->name);
+    uint8_t * ret_val = filecache_create_copy(
+            key, m->byte_count, m->crc, out_byte_count);
+
+    if(ret_val != 0)
+    {
+        alloc_free(key);
+        return ret_val; // Inflated before.
+    }
+
+    if(f_open(&fil, s_path, FA_READ) != FR_OK)
+    {
+        alloc_free(key);
+        return 0;
+    }
+
+    ret_val = alloc_alloc(m->byte_count + 1);
+    //
+    // (+1 to support empty files, like filesys_load())
+
+    if(ret_val == 0
+        || !read_at(&fil, (FSIZE_t)m->offset, header, MT_ZIP_LFH_LEN)
+        || get_u32(header) != MT_ZIP_LFH_SIG)
+    {
+        alloc_free(ret_val);
+        alloc_free(key);
+        f_close(&fil);
+        return 0;
+    }
+
+    // The local header's extra field may differ from the central one:
+    //
+    FSIZE_t const pos = (FSIZE_t)m->offset
+        + MT_ZIP_LFH_LEN + get_u16(header + 26) + get_u16(header + 28);
+
+    if(m->method == MT_ZIP_METHOD_STORED)
+    {
+        is_ok = m->compressed_len == m->byte_count
+            && read_at(&fil, pos, ret_val, m->byte_count);
+        len = m->byte_count;
+    }
+    else
+    {
+        src = alloc_alloc(m->compressed_len + 1);
+        is_ok = src != 0
+            && read_at(&fil, pos, src, m->compressed_len)
+            && inflate_decompress(
+                src, m->compressed_len, ret_val, m->byte_count, &len);
+        alloc_free(src);
+    }
+    f_close(&fil);
+
+    if(!is_ok || len != m->byte_count || get_crc(ret_val, len) != m->crc)
+    {
+#ifndef NDEBUG
+        console_write("zip/load : Failed to load \"");
+        console_write(m->name);
+        console_writeline("\" (read error or invalid data).");
+#endif //NDEBUG
+        alloc_free(ret_val);
+        alloc_free(key);
+        return 0;
+    }
+
+    filecache_add(key, m->crc, ret_val, len, false);
+    alloc_free(key);
+
+    *out_byte_count = len;
+    return ret_val;
+}
+
+bool zip_mount(char const * const full_path)
+{
+    FIL fil;
+    FILINFO info;
+    uint32_t cd_offset = 0, cd_len = 0, entry_count = 0;
+    uint8_t * cd = 0;
+    bool ret_val = false;
+
+    zip_unmount();
+    filesys_mount();
+
+    if(f_stat(full_path, &info) != FR_OK || (info.fattrib & AM_DIR) != 0)
+    {
+        return false;
+    }
+    if(f_open(&fil, full_path, FA_READ) != FR_OK)
+    {
+        return false;
+    }
+
+    if(read_eocd(&fil, info.fsize, &cd_offset, &cd_len, &entry_count))
+    {
+        cd = alloc_alloc(cd_len + 1); // (+1 for empty archive)
+        ret_val = cd != 0
+            && read_at(&fil, (FSIZE_t)cd_offset, cd, cd_len)
+            && parse(cd, cd_len, entry_count);
+        alloc_free(cd);
+    }
+    f_close(&fil);
+
+    if(!ret_val)
+    {
+        free_members();
+        return false;
+    }
+
+    s_path = str_create_copy(full_path);
+    s_size = info.fsize;
+    s_date = info.fdate;
+    s_time = info.ftime;
+
+#ifndef NDEBUG
+    console_write("zip_mount : Mounted \"");
+    console_write(s_path);
+    console_write("\" with ");
+    console_write_dword_dec((uint32_t)s_member_count);
+    console_writeline(" member(-s).");
+#endif //NDEBUG
+    return true;
+}
+
+void zip_unmount()
+{
+    free_members();
+    alloc_free(s_path);
+    s_path = 0;
+}
+
+bool zip_is_mounted()
+{
+    return s_path != 0;
+}
+
+struct dir_entry * * zip_create_entry_arr(
+    char const * const pattern, int * const count)
+{
+    *count = 0;
+
+    if(!refresh())
+    {
+        return 0;
+    }
+
+    struct dir_entry * * const ret_val = alloc_alloc(
+        (s_member_count + 1) * sizeof *ret_val); // (+1 for empty archive)
+
+    if(ret_val == 0)
+    {
+        return 0;
+    }
+    for(int i = 0;i < s_member_count;++i)
+    {
+        if(pattern != 0 && !str_is_matching(s_members[i].file_name, pattern))
+        {
+            continue;
+        }
+
+        struct dir_entry * const e = alloc_alloc(sizeof *e);
+
+        e->name = str_create_copy(s_members[i].file_name);
+        e->is_dir = false;
+        e->size = s_members[i].byte_count;
+        ret_val[*count] = e;
+        ++(*count);
+    }
+    return ret_val;
+}
+
+uint8_t * zip_load(char const * const pattern, uint32_t * const out_byte_count)
+{
+    *out_byte_count = 0;
+
+    if(!refresh())
+    {
+        return 0;
+    }
+    for(int i = 0;i < s_member_count;++i)
+    {
+        if(str_is_matching(s_members[i].file_name, pattern))
+        {
+            return load(s_members + i, out_byte_count);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Singleton (!) to use a ZIP archive file on the SD card like a folder.
+//
+// - The archive's central directory is read once on mount into an index
+//   holding each member's offset, sizes and CRC-32, so members are found
+//   without scanning the archive.
+// - Members are inflated on demand and cached in RAM (see filecache.h), keyed
+//   by their size and CRC-32, so loading them again does not inflate again.
+// - Supports members stored or compressed via DEFLATE, only (no ZIP64, no
+//   encryption).
+// - Names of members in subfolders of the archive are used without the
+//   subfolders' names.
+// - Read-only.
+
+#ifndef MT_ZIP
+#define MT_ZIP
+
+#include "../dir/dir.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Mount ZIP archive at given full path, reading its central directory.
+ *
+ * - Unmounts archive mounted before, if any.
+ * - Returns false, if the file is not a valid (supported) ZIP archive.
+ */
+bool zip_mount(char const * const full_path);
+
+/**
+ * - OK to be called, if not mounted.
+ */
+void zip_unmount();
+
+bool zip_is_mounted();
+
+/** Return array of the members in mounted archive whose names match given
+ *  pattern [see str_is_matching()], or of all members, if pattern is 0.
+ *
+ * - In order of archive's central directory, sizes in byte (decompressed).
+ * - Caller takes ownership of returned object [see dir_free_entry_arr()].
+ * - Returns 0 on error.
+ */
+struct dir_entry * * zip_create_entry_arr(
+    char const * const pattern, int * const count);
+
+/** Load (decompressed) content of first member in mounted archive whose name
+ *  matches given pattern [see str_is_matching()] and set byte count.
+ *
+ * - Served from file cache, if cached with member's size and CRC-32.
+ * - Otherwise inflates the member, verifies its CRC-32 and caches it.
+ * - Re-reads the central directory, if the archive's size or time stamp
+ *   changed since mount.
+ * - Caller takes ownership of returned object.
+ * - Returns 0 on error (e.g. if not found).
+ */
+uint8_t * zip_load(char const * const pattern, uint32_t * const out_byte_count);
+
+#endif //MT_ZIP
@@ -0,0 +1,259 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Test of lib/sectorcache with a (temporary) image file as backend, counting
+// the backend's reads and writes to check hits, read-ahead, evictions and
+// flush.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../../lib/alloc/alloc.h"
+#include "../../lib/sectorcache/sectorcache.h"
+
+#define SECTOR_LEN MT_SECTORCACHE_SECTOR_LEN
+#define IMAGE_SECTORS 64
+#define CACHE_SECTORS 8
+#define READ_AHEAD 4
+
+static FILE * s_image = 0;
+
+static uint32_t s_reads = 0; // Backend calls.
+static uint32_t s_writes = 0;
+static uint32_t s_written = 0; // Sectors written to backend.
+
+static int s_failed = 0;
+
+static bool read_image(
+    uint32_t const sector, uint32_t const count, uint8_t * const buf)
+{
+    if(sector + count > IMAGE_SECTORS
+        || fseek(s_image, (long)sector * SECTOR_LEN, SEEK_SET) != 0
+        || fread(buf, SECTOR_LEN, count, s_image) != count)
+    {
+        return false;
+    }
+    ++s_reads;
+    return true;
+}
+
+static bool write_image(
+    uint32_t const sector, uint32_t const count, uint8_t const * const buf)
+{
+    if(sector + count > IMAGE_SECTORS
+        || fseek(s_image, (long)sector * SECTOR_LEN, SEEK_SET) != 0
+        || fwrite(buf, SECTOR_LEN, count, s_image) != count)
+    {
+        return false;
+    }
+    ++s_writes;
+    s_written += count;
+    return true;
+}
+
+static void fill_sector(uint8_t * const buf, uint32_t const sector, int const v)
+{
+    for(int i = 0;i < SECTOR_LEN;++i)
+    {
+        buf[i] = (uint8_t)(sector * 7 + (uint32_t)i + (uint32_t)v);
+    }
+}
+
+/** Return true, if given sector of image file holds given version's content.
+ */
+static bool is_in_image(uint32_t const sector, int const v)
+{
+    uint8_t expected[SECTOR_LEN], buf[SECTOR_LEN];
+
+    fill_sector(expected, sector, v);
+    fflush(s_image);
+    if(fseek(s_image, (long)sector * SECTOR_LEN, SEEK_SET) != 0
+        || fread(buf, SECTOR_LEN, 1, s_image) != 1)
+    {
+        return false;
+    }
+    return memcmp(buf, expected, SECTOR_LEN) == 0;
+}
+
+/** Return true, if given sector read via cache holds given version's content.
+ */
+static bool is_read(uint32_t const sector, int const v)
+{
+    uint8_t expected[SECTOR_LEN], buf[SECTOR_LEN];
+
+    fill_sector(expected, sector, v);
+    return sectorcache_read(sector, 1, buf)
+        && memcmp(buf, expected, SECTOR_LEN) == 0;
+}
+
+static void check(bool const result, char const * const what)
+{
+    printf("%-52s %s\n", what, result ? "ok" : "FAILED");
+    if(!result)
+    {
+        ++s_failed;
+    }
+}
+
+static void test_hits()
+{
+    struct sectorcache_stats stats;
+    uint32_t const reads = s_reads;
+
+    check(is_read(10, 0), "Miss reads content from image.");
+    check(is_read(10, 0), "Hit returns same content.");
+    sectorcache_get_stats(&stats);
+    check(
+        s_reads == reads + 1 && stats.read_hits == 1 && stats.read_misses == 1,
+        "Hit does not read from image.");
+}
+
+static void test_read_ahead()
+{
+    struct sectorcache_stats stats;
+    uint32_t const reads = s_reads;
+
+    check(is_read(20, 0) && is_read(21, 0), "Sequential reads.");
+    check(s_reads == reads + 2, "Second one reads ahead in same call.");
+    for(uint32_t s = 22;s < 22 + READ_AHEAD;++s)
+    {
+        is_read(s, 0);
+    }
+    sectorcache_get_stats(&stats);
+    check(
+        s_reads == reads + 2 && stats.read_ahead_hits == READ_AHEAD,
+        "Sectors read ahead are hits.");
+}
+
+static void test_eviction()
+{
+    uint8_t buf[SECTOR_LEN];
+    uint32_t const writes = s_writes;
+
+    fill_sector(buf, 30, 1);
+    check(sectorcache_write(30, 1, buf), "Single-sector write.");
+    check(s_writes == writes && is_in_image(30, 0), "Is not written through.");
+    check(is_read(30, 1), "Is read from cache.");
+
+    for(uint32_t s = 40;s < 40 + 2 * CACHE_SECTORS;s += 2) // (no read-ahead)
+    {
+        is_read(s, 0);
+    }
+    check(
+        s_writes == writes + 1 && is_in_image(30, 1),
+        "Is written back on eviction.");
+    check(is_read(30, 1), "Evicted sector is read from image.");
+}
+
+static void test_write_through()
+{
+    uint8_t buf[2 * SECTOR_LEN];
+    uint32_t const writes = s_writes;
+
+    is_read(50, 0); // (cached)
+    fill_sector(buf, 50, 2);
+    fill_sector(buf + SECTOR_LEN, 51, 2);
+    check(sectorcache_write(50, 2, buf), "Multi-sector write.");
+    check(
+        s_writes == writes + 1 && is_in_image(50, 2) && is_in_image(51, 2),
+        "Is written through.");
+    check(is_read(50, 2), "Cached sector got updated.");
+}
+
+static void test_flush()
+{
+    uint8_t buf[SECTOR_LEN];
+    uint32_t const writes = s_writes, written = s_written;
+
+    for(uint32_t s = 3;s > 0;--s) // (descending order)
+    {
+        fill_sector(buf, s, 3);
+        sectorcache_write(s, 1, buf);
+    }
+    fill_sector(buf, 60, 3);
+    sectorcache_write(60, 1, buf);
+    check(s_writes == writes, "Dirty sectors are not written, yet.");
+
+    check(sectorcache_flush(), "Flush.");
+    check(
+        s_writes == writes + 2 && s_written == written + 4,
+        "Neighbours are merged into one write.");
+    check(
+        is_in_image(1, 3) && is_in_image(2, 3) && is_in_image(3, 3)
+            && is_in_image(60, 3),
+        "Image holds flushed sectors.");
+    check(sectorcache_flush() && s_writes == writes + 2,
+        "Second flush writes nothing.");
+}
+
+static void test_invalidate()
+{
+    uint8_t buf[SECTOR_LEN];
+    uint32_t const writes = s_writes;
+
+    fill_sector(buf, 5, 4);
+    sectorcache_write(5, 1, buf);
+    sectorcache_invalidate();
+    check(sectorcache_flush() && s_writes == writes,
+        "Invalidated sectors are not written back.");
+    check(is_read(5, 0), "Invalidated sector is read from image.");
+}
+
+int main()
+{
+    struct sectorcache_params const params = {
+        .read = read_image,
+        .write = write_image,
+        .sector_count = CACHE_SECTORS,
+        .read_ahead = READ_AHEAD
+    };
+    struct sectorcache_stats stats;
+    size_t const mem_len = 1024 * 1024;
+    void * const mem = malloc(mem_len);
+    uint8_t buf[SECTOR_LEN];
+
+    alloc_init(mem, (MT_USIGN)mem_len);
+
+    s_image = tmpfile();
+    if(s_image == 0)
+    {
+        printf("Error: Failed to create image file!\n");
+        return EXIT_FAILURE;
+    }
+    for(uint32_t s = 0;s < IMAGE_SECTORS;++s)
+    {
+        fill_sector(buf, s, 0);
+        fwrite(buf, SECTOR_LEN, 1, s_image);
+    }
+
+    if(!sectorcache_init(&params))
+    {
+        printf("Error: Failed to initialize cache!\n");
+        return EXIT_FAILURE;
+    }
+
+    test_hits();
+    test_read_ahead();
+    test_eviction();
+    test_write_through();
+    test_flush();
+    test_invalidate();
+
+    sectorcache_get_stats(&stats);
+    printf(
+        "Stats: %u hits, %u misses, %u read ahead (%u hits), %u writes, %u written back.\n",
+        stats.read_hits, stats.read_misses, stats.read_ahead,
+        stats.read_ahead_hits, stats.writes, stats.write_backs);
+
+    check(sectorcache_deinit(), "Deinit.");
+
+    fclose(s_image);
+    free(mem);
+
+    printf(s_failed == 0 ? "All tests passed.\n" : "%d test(s) failed!\n",
+        s_failed);
+    return s_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,186 @@
+
+// Marcel Timm, RhinoDevel, 2026oct19
+
+// Benchmark of lib/sort with arrays of 10 to 10,000 file names (like the
+// entries of a folder on the SD card).
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../lib/alloc/alloc.h"
+#include "../../lib/str/str.h"
+#include "../../lib/sort/sort.h"
+
+#define NAME_LEN 16 // Per name in buffer (8.3 name plus '\0' fits).
+#define MAX_COUNT 10000
+
+static char s_names[MAX_COUNT * NAME_LEN];
+static uint32_t s_seed = 1;
+
+static int cmp_str(void const * const a, void const * const b)
+{
+    return str_cmp(*(char const * const *)a, *(char const * const *)b);
+}
+
+static uint32_t get_rand()
+{
+    s_seed = s_seed * 1103515245 + 12345; // (reproducible)
+    return s_seed >> 16;
+}
+
+/** Fill names buffer with 8.3 names, some of them equal (to test stability).
+ */
+static void fill_names(int const count)
+{
+    static char const * const ext[] = { "PRG", "SEQ", "D64", "TXT" };
+
+    for(int i = 0;i < count;++i)
+    {
+        char * const name = s_names + i * NAME_LEN;
+        int const len = 1 + (int)(get_rand() % 8);
+
+        if(i > 0 && get_rand() % 10 == 0)
+        {
+            strcpy(name, s_names + (get_rand() % i) * NAME_LEN); // Duplicate.
+            continue;
+        }
+        for(int j = 0;j < len;++j)
+        {
+            name[j] = get_rand() % 4 == 0
+                ? (char)('0' + get_rand() % 10)
+                : (char)('A' + get_rand() % 26);
+        }
+        name[len] = '.';
+        strcpy(name + len + 1, ext[get_rand() % 4]);
+    }
+}
+
+static void fill_arr(char * * const arr, int const count)
+{
+    for(int i = 0;i < count;++i)
+    {
+        arr[i] = s_names + i * NAME_LEN;
+    }
+}
+
+/** Return true, if sorted (and stable, if given).
+ */
+static bool is_sorted(char * const * const arr, int const count, bool stable)
+{
+    for(int i = 1;i < count;++i)
+    {
+        int const c = str_cmp(arr[i - 1], arr[i]);
+
+        if(c > 0 || (stable && c == 0 && arr[i - 1] > arr[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static double get_sec()
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec / 1e9;
+}
+
+static void sort_generic_insertion(char * * const arr, int const count)
+{
+    sort_insertion(arr, (size_t)count, sizeof *arr, cmp_str);
+}
+static void sort_generic_heap(char * * const arr, int const count)
+{
+    sort_heap(arr, (size_t)count, sizeof *arr, cmp_str);
+}
+static void sort_generic_intro(char * * const arr, int const count)
+{
+    sort_intro(arr, (size_t)count, sizeof *arr, cmp_str);
+}
+static void sort_generic_merge(char * * const arr, int const count)
+{
+    sort_merge(arr, (size_t)count, sizeof *arr, cmp_str);
+}
+static void sort_pointer_intro(char * * const arr, int const count)
+{
+    sort_ptr_intro((void * *)arr, (size_t)count, cmp_str);
+}
+static void sort_pointer_merge(char * * const arr, int const count)
+{
+    sort_ptr_merge((void * *)arr, (size_t)count, cmp_str);
+}
+
+struct algo
+{
+    char const * name;
+    void (*sort)(char * * const arr, int const count);
+    bool is_stable;
+};
+
+int main()
+{
+    static struct algo const algos[] = {
+        { "insertion", sort_generic_insertion, true },
+        { "heap", sort_generic_heap, false },
+        { "intro", sort_generic_intro, false },
+        { "merge", sort_generic_merge, true },
+        { "ptr_intro", sort_pointer_intro, false },
+        { "ptr_merge", sort_pointer_merge, true }
+    };
+    static int const counts[] = { 10, 100, 1000, 10000 };
+    int const algo_count = (int)(sizeof algos / sizeof *algos);
+    size_t const mem_len = 16 * 1024 * 1024;
+    void * const mem = malloc(mem_len);
+    char * * const arr = malloc(MAX_COUNT * sizeof *arr);
+    bool ok = true;
+
+    alloc_init(mem, (MT_USIGN)mem_len);
+    fill_names(MAX_COUNT);
+
+    printf("%-8s", "count");
+    for(int a = 0;a < algo_count;++a)
+    {
+        printf(" %12s", algos[a].name);
+    }
+    printf("   (microseconds per sort)\n");
+
+    for(int c = 0;c < (int)(sizeof counts / sizeof *counts);++c)
+    {
+        int const count = counts[c],
+            reps = count >= 100000 ? 1 : 100000 / count;
+
+        printf("%-8d", count);
+        for(int a = 0;a < algo_count;++a)
+        {
+            double sum = 0.0;
+
+            for(int r = 0;r < reps;++r)
+            {
+                fill_arr(arr, count);
+
+                double const beg = get_sec();
+
+                algos[a].sort(arr, count);
+                sum += get_sec() - beg;
+            }
+            if(!is_sorted(arr, count, algos[a].is_stable))
+            {
+                printf("\nError: %s failed for %d names!\n", algos[a].name, count);
+                ok = false;
+            }
+            printf(" %12.1f", 1e6 * sum / reps);
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+
+    free(arr);
+    free(mem);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}